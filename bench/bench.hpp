@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Minimal timing helpers shared by the *_bench.cpp executables.
+namespace bench {
+
+    // Best wall time in milliseconds over `reps` runs of f().
+    template <typename F>
+    double bestMs(int reps, F&& f) {
+        double best = 1e300;
+        for (int r = 0; r < reps; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            std::chrono::duration<double, std::milli> took = std::chrono::steady_clock::now() - start;
+            best = std::min(best, took.count());
+        }
+        return best;
+    }
+
+    // Keeps a computed value alive so the optimizer cannot drop the work.
+    template <typename T>
+    void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    // One result row: label, time and throughput of `items` operations.
+    inline void report(const std::string& label, double ms, double items) {
+        std::printf("%-44s %10.2f ms %10.2f M/s\n", label.c_str(), ms, items / ms / 1e3);
+    }
+
+    // argv[i] as an integer, or `fallback` when it is missing.
+    inline long long arg(int argc, char** argv, int i, long long fallback) {
+        return i < argc ? std::atoll(argv[i]) : fallback;
+    }
+
+    // Deterministic xorshift so every run benchmarks the same input.
+    struct Rng {
+        unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+        unsigned long long next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        // Uniform in [0, bound).
+        unsigned long long below(unsigned long long bound) {
+            return next() % bound;
+        }
+    };
+
+} // namespace bench
@@ -0,0 +1,72 @@
+// ParallelBoruvka across thread counts against Kruskal on the same CSR
+// graphs: the comparison sort Kruskal in graph/kruskal.cpp and
+// MinimumSpanningTree (radix sort, Filter-Kruskal). Times cover the solve
+// only, not copying the edges out of the graph.
+//
+// Usage: bench_boruvka_bench [grid side = 1000] [max threads = 8]
+
+#include "bench/bench.hpp"
+#include "bench/graphs.hpp"
+#include "graph/boruvka.hpp"
+#include "graph/kruskal.cpp"
+#include "graph/minimum_spanning_tree.hpp"
+#include "misc/thread_pool.hpp"
+
+#include <string>
+#include <thread>
+
+namespace {
+
+    void runAll(const std::string& name, const algo::CsrGraph<int>& g, int maxThreads) {
+        const double m = static_cast<double>(g.edgeCount());
+        std::printf("%s: n = %d, m = %lld (M/s = arcs)\n", name.c_str(), g.size(), g.edgeCount());
+
+        Kruskal<int> kruskal(g);
+        long long legacy = 0;
+        bench::report("Kruskal (kruskal.cpp, std::sort)", bench::bestMs(1, [&] { legacy = kruskal.calculate(); }), m);
+
+        algo::MinimumSpanningTree<int> mst(g);
+        long long filtered = 0;
+        bench::report("MinimumSpanningTree FilterKruskal", bench::bestMs(3, [&] {
+            filtered = 0;
+            for (const auto& e : mst.solve()) filtered += e.weight;
+        }), m);
+
+        algo::ParallelBoruvka<int> boruvka(g);
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            algo::ThreadPool pool(threads);
+            long long weight = 0;
+            double ms = bench::bestMs(3, [&] {
+                weight = 0;
+                for (const auto& e : boruvka.solve(pool)) weight += e.weight;
+            });
+            if (weight != legacy || weight != filtered) {
+                std::printf("forest weight mismatch: %lld / %lld / %lld\n", legacy, filtered, weight);
+                std::exit(1);
+            }
+            bench::report("ParallelBoruvka t=" + std::to_string(threads) + " rounds=" +
+                              std::to_string(boruvka.rounds()), ms, m);
+        }
+    }
+
+    algo::CsrGraph<int> undirected(int n, const bench::Edges& edges) {
+        algo::CsrGraph<int>::BuildOptions options;
+        options.undirected = true;
+        return algo::CsrGraph<int>(n, edges, options);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int side = static_cast<int>(bench::arg(argc, argv, 1, 1000));
+    const int maxThreads = static_cast<int>(bench::arg(argc, argv, 2, 8));
+
+    // gridEdges already emits both arc directions.
+    runAll("grid (road-like), weights 1..1000",
+           algo::CsrGraph<int>(side * side, bench::gridEdges(side, side, 1000)), maxThreads);
+    std::printf("\n");
+    runAll("random, average degree 8, weights 1..1000",
+           undirected(side * side, bench::randomEdges(side * side, 4LL * side * side, 1000)), maxThreads);
+    std::printf("(hardware threads: %u)\n", std::thread::hardware_concurrency());
+    return 0;
+}
@@ -0,0 +1,57 @@
+// DeltaStepping against sequential Dijkstra, across thread counts and deltas.
+//
+// Usage: bench_delta_stepping_bench [grid side = 1000] [max threads = 8]
+
+#include "bench/bench.hpp"
+#include "bench/graphs.hpp"
+#include "graph/delta_stepping.hpp"
+#include "graph/dijkstra.hpp"
+#include "misc/thread_pool.hpp"
+
+#include <string>
+#include <thread>
+
+namespace {
+
+    void runAll(const std::string& name, const algo::CsrGraph<int>& g, int maxThreads) {
+        const double m = static_cast<double>(g.edgeCount());
+        std::printf("%s: n = %d, m = %lld (M/s = arcs)\n", name.c_str(), g.size(), g.edgeCount());
+
+        algo::Dijkstra dijkstra(g.size());
+        bench::report("algo::Dijkstra (4-ary heap)", bench::bestMs(3, [&] {
+            dijkstra.run(g, 0);
+            bench::keep(dijkstra.distance(g.size() - 1));
+        }), m);
+
+        const long long autoDelta = algo::DeltaStepping::autoDelta(g);
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            algo::ThreadPool pool(threads);
+            algo::DeltaStepping ds(&pool);
+            for (long long delta : {autoDelta / 4, autoDelta, autoDelta * 4}) {
+                if (delta < 1) continue;
+                double ms = bench::bestMs(3, [&] { ds.run(g, 0, delta); });
+                if (ds.distance(g.size() - 1) != dijkstra.distance(g.size() - 1)) {
+                    std::printf("distance mismatch\n");
+                    std::exit(1);
+                }
+                bench::report("DeltaStepping t=" + std::to_string(threads) + " delta=" + std::to_string(delta) +
+                                  (delta == autoDelta ? " (auto)" : "") + " ph=" + std::to_string(ds.phases()),
+                              ms, m);
+            }
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int side = static_cast<int>(bench::arg(argc, argv, 1, 1000));
+    const int maxThreads = static_cast<int>(bench::arg(argc, argv, 2, 8));
+
+    runAll("grid (road-like), weights 1..1000",
+           algo::CsrGraph<int>(side * side, bench::gridEdges(side, side, 1000)), maxThreads);
+    std::printf("\n");
+    runAll("random, average degree 8, weights 1..1000",
+           algo::CsrGraph<int>(side * side, bench::randomEdges(side * side, 8LL * side * side, 1000)), maxThreads);
+    std::printf("(hardware threads: %u)\n", std::thread::hardware_concurrency());
+    return 0;
+}
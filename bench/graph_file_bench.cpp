@@ -0,0 +1,60 @@
+// Loading a graph: parsing a text edge list into vector<Edge> and building a
+// CsrGraph, against converting it once to a GraphFile and mapping that.
+// Dijkstra then runs on both. The page cache is warm in every row; the
+// text and graph files go to the temp directory and are removed at exit.
+//
+// Usage: bench_graph_file_bench [n = 1000000] [m = 20000000]
+
+#include "bench/bench.hpp"
+#include "bench/graphs.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/graph_file.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const int n = static_cast<int>(bench::arg(argc, argv, 1, 1000000));
+    const long long m = bench::arg(argc, argv, 2, 20000000);
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string text = (dir / "algo_graph_file_bench.txt").string();
+    const std::string binary = (dir / "algo_graph_file_bench.bin").string();
+    {
+        std::ofstream out(text);
+        for (const auto& e : bench::randomEdges(n, m, 1000)) out << e.from << ' ' << e.to << ' ' << e.weight << '\n';
+    }
+    std::printf("random graph, n = %d, m = %lld, text file %.1f MB\n", n, m,
+                static_cast<double>(std::filesystem::file_size(text)) / 1e6);
+
+    algo::CsrGraph<int> parsed;
+    bench::report("ifstream >> into vector<Edge> + CsrGraph", bench::bestMs(1, [&] {
+        std::ifstream in(text);
+        std::vector<algo::CsrGraph<int>::Edge> edges;
+        algo::CsrGraph<int>::Edge e;
+        while (in >> e.from >> e.to >> e.weight) edges.push_back(e);
+        parsed = algo::CsrGraph<int>(n, edges);
+    }), static_cast<double>(m));
+
+    bench::report("GraphFile::convertEdgeList (once)", bench::bestMs(1, [&] {
+        algo::GraphFile::convertEdgeList<int>(text, binary, n);
+    }), static_cast<double>(m));
+
+    algo::CsrGraph<int> mapped;
+    bench::report("GraphFile::load, verify", bench::bestMs(3, [&] { mapped = algo::GraphFile::load<int>(binary); }),
+                  static_cast<double>(m));
+    bench::report("GraphFile::load, no verify", bench::bestMs(3, [&] {
+        mapped = algo::GraphFile::load<int>(binary, false);
+    }), static_cast<double>(m));
+
+    algo::Dijkstra a(n), b(n);
+    bench::report("Dijkstra on the parsed graph", bench::bestMs(3, [&] { a.run(parsed, 0); }), static_cast<double>(m));
+    bench::report("Dijkstra on the mapped graph", bench::bestMs(3, [&] { b.run(mapped, 0); }), static_cast<double>(m));
+
+    const bool same = a.distances() == b.distances();
+    std::printf("  distances %s\n", same ? "match" : "DIFFER");
+    std::filesystem::remove(text);
+    std::filesystem::remove(binary);
+    return same ? 0 : 1;
+}
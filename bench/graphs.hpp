@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "bench/bench.hpp"
+#include "graph/csr_graph.hpp"
+
+// Synthetic inputs shared by the graph benchmarks. Both are deterministic.
+namespace bench {
+
+    using Edges = std::vector<algo::CsrGraph<int>::Edge>;
+
+    // rows x cols grid with 4-neighbour arcs in both directions and random
+    // weights in [1, maxW]: a stand-in for road networks (low degree, large
+    // diameter).
+    inline Edges gridEdges(int rows, int cols, int maxW) {
+        Rng rng;
+        Edges edges;
+        edges.reserve(4LL * rows * cols);
+        auto id = [cols](int r, int c) { return r * cols + c; };
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                if (c + 1 < cols) {
+                    int w = 1 + static_cast<int>(rng.below(maxW));
+                    edges.push_back({id(r, c), id(r, c + 1), w});
+                    edges.push_back({id(r, c + 1), id(r, c), w});
+                }
+                if (r + 1 < rows) {
+                    int w = 1 + static_cast<int>(rng.below(maxW));
+                    edges.push_back({id(r, c), id(r + 1, c), w});
+                    edges.push_back({id(r + 1, c), id(r, c), w});
+                }
+            }
+        }
+        return edges;
+    }
+
+    // m random directed arcs on n vertices with weights in [1, maxW]
+    // (small diameter, like telemetry or social graphs).
+    inline Edges randomEdges(int n, long long m, int maxW) {
+        Rng rng;
+        Edges edges(m);
+        for (auto& e : edges) {
+            e.from = static_cast<int>(rng.below(n));
+            e.to = static_cast<int>(rng.below(n));
+            e.weight = 1 + static_cast<int>(rng.below(maxW));
+        }
+        return edges;
+    }
+
+} // namespace bench
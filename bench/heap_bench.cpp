@@ -0,0 +1,107 @@
+// algo::Heap (binary / 4-ary / 8-ary) against std::priority_queue and the
+// original sign-flipping binary heap.
+//
+// Usage: bench_heap_bench [n = 1000000]
+
+#include "bench/bench.hpp"
+#include "data_structure/heap.hpp"
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace {
+
+    // The Heap this repo shipped before it became comparator driven.
+    template <typename T>
+    class LegacyHeap {
+    public:
+        explicit LegacyHeap(bool isMinHeap = true) : symbol(isMinHeap ? 1 : -1) {}
+
+        T pop() {
+            T ret = arr[0] * symbol;
+            arr[0] = arr.back();
+            arr.pop_back();
+            sink(0);
+            return ret;
+        }
+
+        void add(T x) {
+            arr.push_back(x * symbol);
+            int pos = static_cast<int>(arr.size()) - 1;
+            while (pos > 0 && arr[pos] < arr[(pos - 1) >> 1]) {
+                std::swap(arr[pos], arr[(pos - 1) >> 1]);
+                pos = (pos - 1) >> 1;
+            }
+        }
+
+    private:
+        short symbol;
+        std::vector<T> arr;
+
+        bool greater(int a, int b) {
+            if (b >= static_cast<int>(arr.size())) return false;
+            return arr[a] > arr[b];
+        }
+
+        void sink(int pos) {
+            while (greater(pos, pos * 2 + 1) || greater(pos, pos * 2 + 2)) {
+                int child = greater(pos * 2 + 1, pos * 2 + 2) ? pos * 2 + 2 : pos * 2 + 1;
+                std::swap(arr[pos], arr[child]);
+                pos = child;
+            }
+        }
+    };
+
+    template <typename Push, typename Pop>
+    void pushPopAll(const std::vector<long long>& keys, Push push, Pop pop) {
+        long long sum = 0;
+        for (long long k : keys) push(k);
+        for (std::size_t i = 0; i < keys.size(); ++i) sum += pop();
+        bench::keep(sum);
+    }
+
+    template <int Arity>
+    double algoHeap(const std::vector<long long>& keys) {
+        return bench::bestMs(3, [&] {
+            algo::MinHeap<long long, Arity> h;
+            h.reserve(keys.size());
+            pushPopAll(keys, [&](long long k) { h.add(k); }, [&] { return h.pop(); });
+        });
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const auto n = static_cast<std::size_t>(bench::arg(argc, argv, 1, 1000000));
+    bench::Rng rng;
+    std::vector<long long> keys(n);
+    for (auto& k : keys) k = static_cast<long long>(rng.below(1ULL << 40));
+    const double ops = 2.0 * static_cast<double>(n);
+
+    std::printf("push n, then pop n; n = %zu random 64-bit keys\n", n);
+    bench::report("std::priority_queue", bench::bestMs(3, [&] {
+        std::priority_queue<long long, std::vector<long long>, std::greater<>> q;
+        pushPopAll(keys, [&](long long k) { q.push(k); }, [&] { long long t = q.top(); q.pop(); return t; });
+    }), ops);
+    bench::report("legacy Heap (sign flip, swaps)", bench::bestMs(3, [&] {
+        LegacyHeap<long long> h;
+        pushPopAll(keys, [&](long long k) { h.add(k); }, [&] { return h.pop(); });
+    }), ops);
+    bench::report("algo::MinHeap<2>", algoHeap<2>(keys), ops);
+    bench::report("algo::MinHeap<4>", algoHeap<4>(keys), ops);
+    bench::report("algo::MinHeap<8>", algoHeap<8>(keys), ops);
+
+    std::printf("\nbuild only; n = %zu\n", n);
+    bench::report("algo::MinHeap<4> n x add", bench::bestMs(3, [&] {
+        algo::MinHeap<long long, 4> h;
+        h.reserve(n);
+        for (long long k : keys) h.add(k);
+        bench::keep(h.top());
+    }), static_cast<double>(n));
+    bench::report("algo::MinHeap<4> heapify constructor", bench::bestMs(3, [&] {
+        algo::MinHeap<long long, 4> h(keys);
+        bench::keep(h.top());
+    }), static_cast<double>(n));
+    return 0;
+}
@@ -0,0 +1,64 @@
+// Lca backends (BinaryLifting, EulerRmq) on random trees: build time,
+// memory and random lca() queries. Queries are drawn on the fly so q can be
+// far larger than memory allows for a query array.
+//
+// Usage: bench_lca_bench [n = 1000000] [queries = 10000000]
+
+#include "bench/bench.hpp"
+#include "graph/lca.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+    void runAll(const std::string& name, const std::vector<int>& parent, long long queries) {
+        const int n = static_cast<int>(parent.size());
+        std::printf("%s: n = %d, q = %lld (M/s = queries)\n", name.c_str(), n, queries);
+        long long checksum[2] = {0, 0};
+        int i = 0;
+        for (auto backend : {algo::Lca::Backend::BinaryLifting, algo::Lca::Backend::EulerRmq}) {
+            const bool rmq = backend == algo::Lca::Backend::EulerRmq;
+            algo::Lca lca = algo::Lca::fromParents(parent, backend);
+            std::printf("  %-10s build %8.2f ms, %7.1f MB held, %7.1f MB peak\n", rmq ? "EulerRmq" : "Lifting",
+                        lca.stats().seconds * 1e3, static_cast<double>(lca.stats().bytes) / 1e6,
+                        static_cast<double>(lca.stats().peakBytes) / 1e6);
+            bench::report(std::string("  lca() ") + (rmq ? "EulerRmq" : "BinaryLifting"), bench::bestMs(1, [&] {
+                bench::Rng rng;
+                long long sum = 0;
+                for (long long q = 0; q < queries; ++q) {
+                    sum += lca.lca(static_cast<int>(rng.below(n)), static_cast<int>(rng.below(n)));
+                }
+                checksum[i] = sum;
+            }), static_cast<double>(queries));
+            ++i;
+        }
+        if (checksum[0] != checksum[1]) {
+            std::printf("lca mismatch\n");
+            std::exit(1);
+        }
+    }
+
+    // parent[v] uniform in [max(0, v - window), v): window = n gives a
+    // random recursive tree of height O(log n), a small window a deep one.
+    std::vector<int> randomTree(int n, int window) {
+        bench::Rng rng;
+        std::vector<int> parent(n, -1);
+        for (int v = 1; v < n; ++v) {
+            int lo = std::max(0, v - window);
+            parent[v] = lo + static_cast<int>(rng.below(v - lo));
+        }
+        return parent;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int n = static_cast<int>(bench::arg(argc, argv, 1, 1000000));
+    const long long queries = bench::arg(argc, argv, 2, 10000000);
+
+    runAll("random recursive tree (shallow)", randomTree(n, n), queries);
+    std::printf("\n");
+    runAll("parent within 16 of the child (deep)", randomTree(n, 16), queries);
+    return 0;
+}
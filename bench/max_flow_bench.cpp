@@ -0,0 +1,132 @@
+// algo::MaxFlow (iterative Dinic, HLPP) against the recursive Sap in
+// graph/sap_maxflow.cpp on layered, grid and bipartite networks.
+//
+// Usage: bench_max_flow_bench [scale = 1]
+
+#include "bench/bench.hpp"
+#include "graph/max_flow.hpp"
+#include "graph/sap_maxflow.cpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Network {
+        std::string name;
+        int n = 0, s = 0, t = 0;
+        std::vector<std::array<int, 3>> edges;
+    };
+
+    // `layers` layers of `width` vertices; each vertex has `fan` random arcs
+    // into the next layer.
+    Network layered(int layers, int width, int fan) {
+        bench::Rng rng;
+        Network net;
+        net.name = "layered " + std::to_string(layers) + "x" + std::to_string(width);
+        net.n = layers * width + 2;
+        net.s = net.n - 2;
+        net.t = net.n - 1;
+        for (int i = 0; i < width; ++i) {
+            net.edges.push_back({net.s, i, 1 << 20});
+            net.edges.push_back({(layers - 1) * width + i, net.t, 1 << 20});
+        }
+        for (int l = 0; l + 1 < layers; ++l) {
+            for (int i = 0; i < width; ++i) {
+                for (int k = 0; k < fan; ++k) {
+                    int j = static_cast<int>(rng.below(width));
+                    net.edges.push_back({l * width + i, (l + 1) * width + j, 1 + static_cast<int>(rng.below(100))});
+                }
+            }
+        }
+        return net;
+    }
+
+    // side x side grid, arcs in both directions, source left column, sink
+    // right column.
+    Network grid(int side) {
+        bench::Rng rng;
+        Network net;
+        net.name = "grid " + std::to_string(side) + "x" + std::to_string(side);
+        net.n = side * side + 2;
+        net.s = net.n - 2;
+        net.t = net.n - 1;
+        auto id = [side](int r, int c) { return r * side + c; };
+        for (int r = 0; r < side; ++r) {
+            net.edges.push_back({net.s, id(r, 0), 1 << 20});
+            net.edges.push_back({id(r, side - 1), net.t, 1 << 20});
+            for (int c = 0; c < side; ++c) {
+                if (c + 1 < side) {
+                    net.edges.push_back({id(r, c), id(r, c + 1), 1 + static_cast<int>(rng.below(100))});
+                    net.edges.push_back({id(r, c + 1), id(r, c), 1 + static_cast<int>(rng.below(100))});
+                }
+                if (r + 1 < side) {
+                    net.edges.push_back({id(r, c), id(r + 1, c), 1 + static_cast<int>(rng.below(100))});
+                    net.edges.push_back({id(r + 1, c), id(r, c), 1 + static_cast<int>(rng.below(100))});
+                }
+            }
+        }
+        return net;
+    }
+
+    // Unit-capacity bipartite matching, `side` vertices per side, `degree`
+    // random arcs per left vertex.
+    Network bipartite(int side, int degree) {
+        bench::Rng rng;
+        Network net;
+        net.name = "bipartite " + std::to_string(side) + "+" + std::to_string(side);
+        net.n = 2 * side + 2;
+        net.s = net.n - 2;
+        net.t = net.n - 1;
+        for (int i = 0; i < side; ++i) {
+            net.edges.push_back({net.s, i, 1});
+            net.edges.push_back({side + i, net.t, 1});
+            for (int k = 0; k < degree; ++k) {
+                net.edges.push_back({i, side + static_cast<int>(rng.below(side)), 1});
+            }
+        }
+        return net;
+    }
+
+    void runAll(const Network& net) {
+        std::printf("%s: n = %d, m = %zu\n", net.name.c_str(), net.n, net.edges.size());
+        long long expect = -1;
+        auto check = [&](long long flow) {
+            if (expect < 0) expect = flow;
+            if (flow != expect) {
+                std::printf("flow mismatch\n");
+                std::exit(1);
+            }
+        };
+        const double m = static_cast<double>(net.edges.size());
+
+        bench::report("Sap (sap_maxflow.cpp)", bench::bestMs(3, [&] {
+            Sap sap(net.n, net.s, net.t);
+            for (auto [u, v, c] : net.edges) sap.addedge(u, v, c);
+            check(sap.calculate());
+        }), m);
+        bench::report("MaxFlow::dinic", bench::bestMs(3, [&] {
+            algo::MaxFlow mf(net.n);
+            mf.reserve(static_cast<int>(net.edges.size()));
+            for (auto [u, v, c] : net.edges) mf.addEdge(u, v, c);
+            check(mf.dinic(net.s, net.t));
+        }), m);
+        bench::report("MaxFlow::hlpp", bench::bestMs(3, [&] {
+            algo::MaxFlow mf(net.n);
+            mf.reserve(static_cast<int>(net.edges.size()));
+            for (auto [u, v, c] : net.edges) mf.addEdge(u, v, c);
+            check(mf.hlpp(net.s, net.t));
+        }), m);
+        std::printf("  max flow %lld\n", expect);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int scale = static_cast<int>(bench::arg(argc, argv, 1, 1));
+    runAll(layered(50, 400 * scale, 4));
+    runAll(grid(150 * scale));
+    runAll(bipartite(50000 * scale, 5));
+    return 0;
+}
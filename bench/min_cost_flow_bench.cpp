@@ -0,0 +1,70 @@
+// algo::MinCostFlow (Dijkstra with potentials) against the SPFA-based
+// MinCostFlow in graph/min_cost_flow.cpp on dense transport networks.
+//
+// Usage: bench_min_cost_flow_bench [k = 500] [max supply = 100]
+
+#include "bench/bench.hpp"
+#include "graph/min_cost_flow.cpp"
+#include "graph/min_cost_flow.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Transport {
+        int n = 0, s = 0, t = 0;
+        std::vector<std::array<int, 4>> edges; // from, to, capacity, cost
+    };
+
+    // k plants, k customers, every plant connected to every customer with a
+    // random cost; plant supplies and customer demands in [1, maxSupply].
+    Transport transport(int k, int maxSupply) {
+        bench::Rng rng;
+        Transport net;
+        net.n = 2 * k + 2;
+        net.s = 2 * k;
+        net.t = 2 * k + 1;
+        for (int i = 0; i < k; ++i) {
+            net.edges.push_back({net.s, i, 1 + static_cast<int>(rng.below(maxSupply)), 0});
+            net.edges.push_back({k + i, net.t, 1 + static_cast<int>(rng.below(maxSupply)), 0});
+        }
+        for (int i = 0; i < k; ++i) {
+            for (int j = 0; j < k; ++j) {
+                net.edges.push_back({i, k + j, maxSupply, 1 + static_cast<int>(rng.below(100))});
+            }
+        }
+        return net;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int k = static_cast<int>(bench::arg(argc, argv, 1, 500));
+    const int maxSupply = static_cast<int>(bench::arg(argc, argv, 2, 100));
+    const Transport net = transport(k, maxSupply);
+    std::printf("dense transport, %d plants x %d customers, m = %zu, supplies 1..%d\n", k, k, net.edges.size(),
+                maxSupply);
+
+    long long legacyCost = 0;
+    bench::report("MinCostFlow (min_cost_flow.cpp, SPFA)", bench::bestMs(1, [&] {
+        ::MinCostFlow mcf(net.n, net.s, net.t);
+        for (auto [u, v, c, w] : net.edges) mcf.addedge(u, v, c, w);
+        legacyCost = mcf.calculate();
+    }), static_cast<double>(net.edges.size()));
+
+    algo::MinCostFlow::Result result;
+    long long augmentations = 0;
+    bench::report("algo::MinCostFlow (Dijkstra, potentials)", bench::bestMs(3, [&] {
+        algo::MinCostFlow mcf(net.n);
+        mcf.reserve(static_cast<int>(net.edges.size()));
+        for (auto [u, v, c, w] : net.edges) mcf.addEdge(u, v, c, w);
+        result = mcf.solve(net.s, net.t);
+        augmentations = mcf.augmentations();
+    }), static_cast<double>(net.edges.size()));
+
+    std::printf("  flow %lld, cost %lld (SPFA version %lld), %lld augmentations\n", result.flow, result.cost,
+                legacyCost, augmentations);
+    return result.cost == legacyCost ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+// MinimumSpanningTree (radix sort, Filter-Kruskal) against the comparison
+// sort Kruskal in graph/kruskal.cpp on random graphs. Each engine gets its
+// own copy of the edges, generated from the same seed, so only one copy is
+// alive at a time; times exclude loading the edges. Kruskal<int> sums the
+// forest weight in an int, so keep the weights small enough for that.
+//
+// Usage: bench_minimum_spanning_tree_bench [n = 1000000] [m = 20000000] [max weight = 10000]
+
+#include "bench/bench.hpp"
+#include "graph/kruskal.cpp"
+#include "graph/minimum_spanning_tree.hpp"
+
+#include <optional>
+
+namespace {
+
+    template <typename F>
+    void forEachEdge(int n, long long m, int maxW, F&& add) {
+        bench::Rng rng;
+        for (long long i = 0; i < m; ++i) {
+            int u = static_cast<int>(rng.below(n));
+            int v = static_cast<int>(rng.below(n));
+            add(u, v, 1 + static_cast<int>(rng.below(maxW)));
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int n = static_cast<int>(bench::arg(argc, argv, 1, 1000000));
+    const long long m = bench::arg(argc, argv, 2, 20000000);
+    const int maxW = static_cast<int>(bench::arg(argc, argv, 3, 10000));
+    std::printf("random graph, n = %d, m = %lld, weights 1..%d\n", n, m, maxW);
+
+    int legacy = 0;
+    {
+        std::optional<Kruskal<int>> kruskal(n);
+        forEachEdge(n, m, maxW, [&](int u, int v, int w) { kruskal->add_edge(u, v, w); });
+        bench::report("Kruskal (kruskal.cpp, std::sort)", bench::bestMs(1, [&] { legacy = kruskal->calculate(); }),
+                      static_cast<double>(m));
+    }
+
+    long long weights[2] = {0, 0};
+    std::size_t sorted[2] = {0, 0};
+    const char* labels[2] = {"MinimumSpanningTree Kruskal (radix)", "MinimumSpanningTree FilterKruskal"};
+    using Mst = algo::MinimumSpanningTree<int>;
+    const Mst::Method methods[2] = {Mst::Method::Kruskal, Mst::Method::FilterKruskal};
+    for (int i = 0; i < 2; ++i) {
+        Mst mst(n);
+        mst.reserve(static_cast<std::size_t>(m));
+        forEachEdge(n, m, maxW, [&](int u, int v, int w) { mst.addEdge(u, v, w); });
+        bench::report(labels[i], bench::bestMs(1, [&] {
+            for (const auto& e : mst.solve(methods[i])) weights[i] += e.weight;
+        }), static_cast<double>(m));
+        sorted[i] = mst.sortedEdges();
+    }
+
+    std::printf("  forest weight %d / %lld / %lld, radix sorted %zu / %zu edges\n", legacy, weights[0], weights[1],
+                sorted[0], sorted[1]);
+    return legacy == weights[0] && legacy == weights[1] ? 0 : 1;
+}
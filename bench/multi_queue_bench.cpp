@@ -0,0 +1,105 @@
+// MultiQueue throughput against one mutex-protected algo::Heap as the thread
+// count grows, and the rank error of its relaxed pops.
+//
+// Usage: bench_multi_queue_bench [ops per thread = 1000000] [max threads = 8]
+
+#include "bench/bench.hpp"
+#include "data_structure/heap.hpp"
+#include "data_structure/multi_queue.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    // Each thread alternates push and pop on a pre-filled queue, the steady
+    // state of a branch-and-bound or event worker.
+    template <typename Push, typename Pop>
+    double throughput(int threads, long long ops, Push push, Pop pop) {
+        return bench::bestMs(3, [&] {
+            std::vector<std::thread> pool;
+            for (int t = 0; t < threads; ++t) {
+                pool.emplace_back([&, t] {
+                    bench::Rng rng;
+                    rng.state += static_cast<unsigned long long>(t) * 0x2545F4914F6CDD1DULL;
+                    long long sum = 0;
+                    for (long long i = 0; i < ops / 2; ++i) {
+                        push(static_cast<long long>(rng.below(1ULL << 30)));
+                        sum += pop();
+                    }
+                    bench::keep(sum);
+                });
+            }
+            for (auto& th : pool) th.join();
+        });
+    }
+
+    // Pop everything from `queues` heaps filled with 0..n-1 in random order and
+    // report the rank of each popped key among the keys still queued.
+    void rankError(int threads, int n) {
+        algo::MultiQueue<int, int> q(threads);
+        bench::Rng rng;
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; ++i) keys[i] = i;
+        for (int i = n - 1; i > 0; --i) std::swap(keys[i], keys[rng.below(i + 1)]);
+        for (int k : keys) q.push(k, k);
+
+        std::vector<int> bit(n + 1, 0);
+        auto update = [&](int i, int d) { for (++i; i <= n; i += i & -i) bit[i] += d; };
+        auto below = [&](int i) { int r = 0; for (; i > 0; i -= i & -i) r += bit[i]; return r; };
+        for (int k = 0; k < n; ++k) update(k, 1);
+
+        long long total = 0;
+        int worst = 0;
+        std::vector<int> ranks;
+        ranks.reserve(n);
+        while (auto e = q.tryPop()) {
+            int rank = below(e->first);
+            total += rank;
+            worst = std::max(worst, rank);
+            ranks.push_back(rank);
+            update(e->first, -1);
+        }
+        std::sort(ranks.begin(), ranks.end());
+        std::printf("  %2d threads, %3d heaps: mean %6.2f  p99 %5d  max %5d\n", threads, q.queues(),
+                    static_cast<double>(total) / n, ranks[ranks.size() * 99 / 100], worst);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const long long ops = bench::arg(argc, argv, 1, 1000000);
+    const int maxThreads = static_cast<int>(bench::arg(argc, argv, 2, 8));
+    constexpr int kPrefill = 1 << 16;
+
+    std::printf("alternating push/pop, %lld ops per thread, %d keys prefilled (M/s = total ops)\n",
+                ops, kPrefill);
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        const double total = static_cast<double>(ops) * threads;
+
+        std::mutex mutex;
+        algo::MinHeap<long long, 8> heap;
+        for (int i = 0; i < kPrefill; ++i) heap.add(i);
+        bench::report("locked algo::Heap, " + std::to_string(threads) + " threads",
+                      throughput(threads, ops,
+                                 [&](long long k) { std::lock_guard lock(mutex); heap.add(k); },
+                                 [&] { std::lock_guard lock(mutex); return heap.pop(); }),
+                      total);
+
+        algo::MultiQueue<long long, int> mq(threads);
+        for (int i = 0; i < kPrefill; ++i) mq.push(i, 0);
+        bench::report("MultiQueue, " + std::to_string(threads) + " threads",
+                      throughput(threads, ops,
+                                 [&](long long k) { mq.push(k, 0); },
+                                 [&] { return mq.tryPop()->first; }),
+                      total);
+    }
+
+    std::printf("\nrank error of sequential pops, 1000000 keys, c = 2\n");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) rankError(threads, 1000000);
+    std::printf("(hardware threads: %u)\n", std::thread::hardware_concurrency());
+    return 0;
+}
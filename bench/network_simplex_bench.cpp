@@ -0,0 +1,77 @@
+// NetworkSimplex against algo::MinCostFlow on transport networks with large
+// supplies, where successive shortest paths needs one search per augmenting
+// path and network simplex does not depend on the amount of flow.
+//
+// Usage: bench_network_simplex_bench [k = 300] [max supply = 100000] [max arc capacity = 100]
+
+#include "bench/bench.hpp"
+#include "graph/min_cost_flow.hpp"
+#include "graph/network_simplex.hpp"
+
+#include <array>
+#include <vector>
+
+namespace {
+
+    struct Transport {
+        int n = 0, s = 0, t = 0;
+        std::vector<std::array<long long, 4>> edges; // from, to, capacity, cost
+    };
+
+    // k plants and k customers with supplies / demands in [1, maxSupply];
+    // every plant ships to every customer at a random cost in [1, 1000] and a
+    // random capacity in [1, maxCapacity]. Small arc capacities force many
+    // augmenting paths.
+    Transport transport(int k, long long maxSupply, long long maxCapacity) {
+        bench::Rng rng;
+        Transport net;
+        net.n = 2 * k + 2;
+        net.s = 2 * k;
+        net.t = 2 * k + 1;
+        for (int i = 0; i < k; ++i) {
+            net.edges.push_back({net.s, i, 1 + static_cast<long long>(rng.below(maxSupply)), 0});
+            net.edges.push_back({k + i, net.t, 1 + static_cast<long long>(rng.below(maxSupply)), 0});
+        }
+        for (int i = 0; i < k; ++i) {
+            for (int j = 0; j < k; ++j) {
+                net.edges.push_back({i, k + j, 1 + static_cast<long long>(rng.below(maxCapacity)),
+                                     1 + static_cast<long long>(rng.below(1000))});
+            }
+        }
+        return net;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int k = static_cast<int>(bench::arg(argc, argv, 1, 300));
+    const long long maxSupply = bench::arg(argc, argv, 2, 100000);
+    const long long maxCapacity = bench::arg(argc, argv, 3, 100);
+    const Transport net = transport(k, maxSupply, maxCapacity);
+    std::printf("dense transport, %d plants x %d customers, m = %zu, supplies 1..%lld, capacities 1..%lld\n", k, k,
+                net.edges.size(), maxSupply, maxCapacity);
+
+    algo::MinCostFlow::Result ssp;
+    long long augmentations = 0;
+    bench::report("algo::MinCostFlow (successive shortest paths)", bench::bestMs(1, [&] {
+        algo::MinCostFlow mcf(net.n);
+        mcf.reserve(static_cast<int>(net.edges.size()));
+        for (auto [u, v, c, w] : net.edges) mcf.addEdge(static_cast<int>(u), static_cast<int>(v), c, w);
+        ssp = mcf.solve(net.s, net.t);
+        augmentations = mcf.augmentations();
+    }), static_cast<double>(net.edges.size()));
+
+    algo::NetworkSimplex::Result simplex;
+    long long pivots = 0;
+    bench::report("algo::NetworkSimplex (block search)", bench::bestMs(3, [&] {
+        algo::NetworkSimplex ns(net.n);
+        ns.reserve(static_cast<int>(net.edges.size()));
+        for (auto [u, v, c, w] : net.edges) ns.addEdge(static_cast<int>(u), static_cast<int>(v), c, w);
+        simplex = ns.solve(net.s, net.t);
+        pivots = ns.pivots();
+    }), static_cast<double>(net.edges.size()));
+
+    std::printf("  flow %lld, cost %lld (MinCostFlow %lld / %lld), %lld augmentations, %lld pivots\n", simplex.flow,
+                simplex.cost, ssp.flow, ssp.cost, augmentations, pivots);
+    return simplex.flow == ssp.flow && simplex.cost == ssp.cost ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+// Point-to-point queries per second: full single-source Dijkstra against
+// bidirectional Dijkstra, A* and bidirectional A* with ALT landmarks.
+//
+// Usage: bench_point_to_point_bench [grid side = 1000] [queries = 200] [landmarks = 8]
+
+#include "bench/bench.hpp"
+#include "bench/graphs.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/point_to_point.hpp"
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    template <typename Query>
+    void measure(const std::string& label, const std::vector<std::pair<int, int>>& queries,
+                 const std::vector<long long>& expect, Query query) {
+        long long checksum = 0;
+        double ms = bench::bestMs(1, [&] {
+            for (std::size_t i = 0; i < queries.size(); ++i) {
+                long long d = query(queries[i].first, queries[i].second);
+                if (d != expect[i]) {
+                    std::printf("%s: wrong distance\n", label.c_str());
+                    std::exit(1);
+                }
+                checksum += d;
+            }
+        });
+        bench::keep(checksum);
+        std::printf("%-44s %10.3f ms/query %10.1f queries/s\n", label.c_str(), ms / queries.size(),
+                    1e3 * queries.size() / ms);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int side = static_cast<int>(bench::arg(argc, argv, 1, 1000));
+    const int count = static_cast<int>(bench::arg(argc, argv, 2, 200));
+    const int landmarks = static_cast<int>(bench::arg(argc, argv, 3, 8));
+    const algo::CsrGraph<int> g(side * side, bench::gridEdges(side, side, 1000));
+
+    bench::Rng rng;
+    std::vector<std::pair<int, int>> queries(count);
+    for (auto& [s, t] : queries) {
+        s = static_cast<int>(rng.below(g.size()));
+        t = static_cast<int>(rng.below(g.size()));
+    }
+
+    algo::Dijkstra dijkstra(g.size());
+    std::vector<long long> expect(count);
+    for (int i = 0; i < count; ++i) {
+        dijkstra.run(g, queries[i].first);
+        expect[i] = dijkstra.distance(queries[i].second);
+    }
+
+    algo::PointToPoint<int> p2p(g);
+    std::optional<algo::AltHeuristic> alt;
+    double prepMs = bench::bestMs(1, [&] {
+        alt.emplace(g, p2p.reverseGraph(), algo::AltHeuristic::selectLandmarks(g, landmarks));
+    });
+
+    std::printf("grid %dx%d (road-like), %d random queries; ALT preprocessing %d landmarks: %.0f ms\n",
+                side, side, count, landmarks, prepMs);
+    measure("full Dijkstra per query", queries, expect, [&](int s, int t) {
+        dijkstra.run(g, s);
+        return dijkstra.distance(t);
+    });
+    long long settled = 0;
+    measure("bidirectional Dijkstra", queries, expect, [&](int s, int t) {
+        long long d = p2p.bidirectionalDijkstra(s, t);
+        settled += p2p.settled();
+        return d;
+    });
+    std::printf("%44s %10.0f settled/query\n", "", static_cast<double>(settled) / count);
+    settled = 0;
+    measure("A*, ALT", queries, expect, [&](int s, int t) {
+        long long d = p2p.astar(s, t, *alt);
+        settled += p2p.settled();
+        return d;
+    });
+    std::printf("%44s %10.0f settled/query\n", "", static_cast<double>(settled) / count);
+    settled = 0;
+    measure("bidirectional A*, ALT", queries, expect, [&](int s, int t) {
+        long long d = p2p.bidirectionalAstar(s, t, *alt);
+        settled += p2p.settled();
+        return d;
+    });
+    std::printf("%44s %10.0f settled/query\n", "", static_cast<double>(settled) / count);
+    return 0;
+}
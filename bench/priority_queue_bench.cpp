@@ -0,0 +1,134 @@
+// RadixHeap and PairingHeap against algo::Heap on a Dijkstra trace, plus
+// PairingHeap::meld against small-to-large merging of algo::Heap.
+//
+// Usage: bench_priority_queue_bench [n = 262144] [degree = 8]
+
+#include "bench/bench.hpp"
+#include "data_structure/heap.hpp"
+#include "data_structure/pairing_heap.hpp"
+#include "data_structure/radix_heap.hpp"
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    using Dist = unsigned long long;
+    using Graph = std::vector<std::vector<std::pair<int, unsigned>>>;
+    constexpr Dist kInf = std::numeric_limits<Dist>::max();
+
+    Graph randomGraph(int n, int degree) {
+        bench::Rng rng;
+        Graph g(n);
+        for (int u = 0; u < n; ++u) {
+            for (int k = 0; k < degree; ++k) {
+                g[u].push_back({static_cast<int>(rng.below(n)), static_cast<unsigned>(1 + rng.below(1000))});
+            }
+        }
+        return g;
+    }
+
+    Dist dijkstraHeap(const Graph& g) {
+        std::vector<Dist> dist(g.size(), kInf);
+        algo::MinHeap<std::pair<Dist, int>, 4> h;
+        dist[0] = 0;
+        h.add({0, 0});
+        while (!h.empty()) {
+            auto [d, u] = h.pop();
+            if (d != dist[u]) continue;
+            for (auto [v, w] : g[u]) {
+                if (d + w < dist[v]) {
+                    dist[v] = d + w;
+                    h.add({dist[v], v});
+                }
+            }
+        }
+        return dist.back();
+    }
+
+    Dist dijkstraRadix(const Graph& g) {
+        std::vector<Dist> dist(g.size(), kInf);
+        algo::RadixHeap<Dist, int> h;
+        dist[0] = 0;
+        h.push(0, 0);
+        while (!h.empty()) {
+            auto [d, u] = h.pop();
+            if (d != dist[u]) continue;
+            for (auto [v, w] : g[u]) {
+                if (d + w < dist[v]) {
+                    dist[v] = d + w;
+                    h.push(dist[v], v);
+                }
+            }
+        }
+        return dist.back();
+    }
+
+    Dist dijkstraPairing(const Graph& g) {
+        std::vector<Dist> dist(g.size(), kInf);
+        std::vector<int> handle(g.size(), -1);
+        algo::PairingHeap<std::pair<Dist, int>> h;
+        dist[0] = 0;
+        handle[0] = h.push({0, 0});
+        while (!h.empty()) {
+            auto [d, u] = h.pop();
+            handle[u] = -2;
+            for (auto [v, w] : g[u]) {
+                if (handle[v] == -2 || d + w >= dist[v]) continue;
+                dist[v] = d + w;
+                if (handle[v] < 0) handle[v] = h.push({dist[v], v});
+                else h.decreaseKey(handle[v], {dist[v], v});
+            }
+        }
+        return dist.back();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int n = static_cast<int>(bench::arg(argc, argv, 1, 1 << 18));
+    const int degree = static_cast<int>(bench::arg(argc, argv, 2, 8));
+    const Graph g = randomGraph(n, degree);
+    const double m = static_cast<double>(n) * degree;
+
+    std::printf("Dijkstra, n = %d, m = %.0f, weights 1..1000 (M/s = edges relaxed)\n", n, m);
+    Dist expect = dijkstraHeap(g);
+    if (dijkstraRadix(g) != expect || dijkstraPairing(g) != expect) {
+        std::printf("mismatched distances\n");
+        return 1;
+    }
+    bench::report("algo::MinHeap<4>, lazy deletion", bench::bestMs(3, [&] { bench::keep(dijkstraHeap(g)); }), m);
+    bench::report("algo::RadixHeap, lazy deletion", bench::bestMs(3, [&] { bench::keep(dijkstraRadix(g)); }), m);
+    bench::report("algo::PairingHeap, decrease-key", bench::bestMs(3, [&] { bench::keep(dijkstraPairing(g)); }), m);
+
+    // Meld n singleton queues pairwise up to one, like queues kept per
+    // DisjointSet component.
+    std::printf("\nmeld %d singleton queues into one\n", n);
+    bench::report("algo::Heap, small-to-large", bench::bestMs(3, [&] {
+        std::vector<algo::MinHeap<int>> q(n);
+        for (int i = 0; i < n; ++i) q[i].add(i);
+        for (int step = 1; step < n; step *= 2) {
+            for (int i = 0; i + step < n; i += 2 * step) {
+                auto& a = q[i];
+                auto& b = q[i + step];
+                if (a.size() < b.size()) std::swap(a, b);
+                while (!b.empty()) a.add(b.pop());
+            }
+        }
+        bench::keep(q[0].top());
+    }), n);
+    bench::report("algo::PairingHeap::meld", bench::bestMs(3, [&] {
+        auto pool = std::make_shared<algo::PairingHeap<int>::Pool>();
+        pool->reserve(n);
+        std::vector<algo::PairingHeap<int>> q;
+        q.reserve(n);
+        for (int i = 0; i < n; ++i) q.emplace_back(pool).push(i);
+        for (int step = 1; step < n; step *= 2) {
+            for (int i = 0; i + step < n; i += 2 * step) q[i].meld(q[i + step]);
+        }
+        bench::keep(q[0].top());
+    }), n);
+    return 0;
+}
@@ -0,0 +1,109 @@
+// algo::Spfa (FIFO, SLF, SLF+LLL, parallel Bellman-Ford) against the
+// original spfa() in graph/spfa.cpp on inputs that are hard for SPFA.
+//
+// Usage: bench_spfa_bench [side = 300] [max threads = 4]
+
+#include "bench/bench.hpp"
+#include "bench/graphs.hpp"
+#include "graph/spfa.cpp"
+#include "graph/spfa.hpp"
+#include "misc/thread_pool.hpp"
+
+#include <string>
+#include <thread>
+
+namespace {
+
+    using Graph = algo::CsrGraph<int>;
+
+    // Grid with heavy random horizontal arcs and light vertical ones. FIFO
+    // SPFA keeps finding slightly better paths through the light columns and
+    // re-queues the same vertices many times.
+    Graph antiSpfaGrid(int rows, int cols) {
+        bench::Rng rng;
+        bench::Edges edges;
+        auto id = [cols](int r, int c) { return r * cols + c; };
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                if (c + 1 < cols) {
+                    int w = 1 + static_cast<int>(rng.below(1000000));
+                    edges.push_back({id(r, c), id(r, c + 1), w});
+                    edges.push_back({id(r, c + 1), id(r, c), w});
+                }
+                if (r + 1 < rows) {
+                    int w = 1 + static_cast<int>(rng.below(10));
+                    edges.push_back({id(r, c), id(r + 1, c), w});
+                    edges.push_back({id(r + 1, c), id(r, c), w});
+                }
+            }
+        }
+        return Graph(rows * cols, edges);
+    }
+
+    // Random graph with negative arcs but no negative cycle: non-negative
+    // weights reweighted by random potentials, w + p(u) - p(v).
+    Graph negativeArcs(int n, long long m) {
+        bench::Rng rng;
+        std::vector<int> p(n);
+        for (int& x : p) x = static_cast<int>(rng.below(100000));
+        auto edges = bench::randomEdges(n, m, 1000);
+        for (auto& e : edges) e.weight += p[e.from] - p[e.to];
+        return Graph(n, edges);
+    }
+
+    // Random graph plus one negative cycle hanging off a long path.
+    Graph negativeCycle(int n, long long m) {
+        auto edges = bench::randomEdges(n, m, 1000);
+        for (int v = 0; v + 1 < n; v += n / 64) edges.push_back({v, v + 1, 1});
+        edges.push_back({n - 3, n - 2, -5});
+        edges.push_back({n - 2, n - 1, 1});
+        edges.push_back({n - 1, n - 3, 1});
+        return Graph(n, edges);
+    }
+
+    void runModes(const Graph& g, int maxThreads, bool legacy) {
+        const double m = static_cast<double>(g.edgeCount());
+        if (legacy) {
+            std::vector<int> ret;
+            bench::report("spfa() from spfa.cpp", bench::bestMs(1, [&] {
+                ret.clear();
+                spfa(g, ret, 0);
+            }), m);
+        }
+        const std::pair<const char*, algo::Spfa::Order> orders[] = {
+            {"Fifo", algo::Spfa::Order::Fifo}, {"Slf", algo::Spfa::Order::Slf}, {"SlfLll", algo::Spfa::Order::SlfLll}};
+        for (auto [name, order] : orders) {
+            algo::Spfa spfa(order);
+            bool ok = true;
+            double ms = bench::bestMs(1, [&] { ok = spfa.run(g, 0); });
+            bench::report(std::string("Spfa::run ") + name + (ok ? "" : " [neg. cycle]") + " it=" +
+                              std::to_string(spfa.iterations()) + " rel=" + std::to_string(spfa.relaxations()),
+                          ms, m);
+        }
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            algo::ThreadPool pool(threads);
+            algo::Spfa spfa;
+            bool ok = true;
+            double ms = bench::bestMs(1, [&] { ok = spfa.runParallel(g, 0, pool); });
+            bench::report("runParallel t=" + std::to_string(threads) + (ok ? "" : " [neg. cycle]") + " rounds=" +
+                              std::to_string(spfa.iterations()) + " rel=" + std::to_string(spfa.relaxations()),
+                          ms, m);
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int side = static_cast<int>(bench::arg(argc, argv, 1, 300));
+    const int maxThreads = static_cast<int>(bench::arg(argc, argv, 2, 4));
+    const int n = side * side;
+
+    std::printf("anti-SPFA grid %dx%d, heavy rows / light columns (M/s = arcs per ms of run)\n", side, side);
+    runModes(antiSpfaGrid(side, side), maxThreads, true);
+    std::printf("\nrandom, n = %d, m = %d, negative arcs, no negative cycle\n", n, 8 * n);
+    runModes(negativeArcs(n, 8LL * n), maxThreads, false);
+    std::printf("\nrandom, n = %d, m = %d, one reachable negative cycle\n", n, 8 * n);
+    runModes(negativeCycle(n, 8LL * n), maxThreads, false);
+    std::printf("(hardware threads: %u)\n", std::thread::hardware_concurrency());
+    return 0;
+}
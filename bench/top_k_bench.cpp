@@ -0,0 +1,66 @@
+// TopK against the per-element algo::Heap push/pop it replaces, plus a
+// multi-threaded run that merges per-thread partial results.
+//
+// Usage: bench_top_k_bench [n = 20000000] [threads = 4]
+
+#include "bench/bench.hpp"
+#include "data_structure/heap.hpp"
+#include "data_structure/top_k.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr int K = 100;
+}
+
+int main(int argc, char** argv) {
+    const auto n = static_cast<std::size_t>(bench::arg(argc, argv, 1, 20000000));
+    const int threads = static_cast<int>(bench::arg(argc, argv, 2, 4));
+    bench::Rng rng;
+    std::vector<int> data(n);
+    for (auto& x : data) x = static_cast<int>(rng.next() >> 33);
+    const double items = static_cast<double>(n);
+
+    std::printf("top-%d of n = %zu random ints (M/s = input elements)\n", K, n);
+    bench::report("algo::Heap push + pop per element", bench::bestMs(3, [&] {
+        algo::MinHeap<int> h;
+        for (int x : data) {
+            h.add(x);
+            if (h.size() > K) h.pop();
+        }
+        bench::keep(h.top());
+    }), items);
+    bench::report("std::nth_element on a copy", bench::bestMs(3, [&] {
+        std::vector<int> copy = data;
+        std::nth_element(copy.begin(), copy.begin() + K, copy.end(), std::greater<>());
+        bench::keep(copy[K]);
+    }), items);
+    bench::report("TopK::add(x) per element", bench::bestMs(3, [&] {
+        algo::TopK<int, K> top;
+        for (int x : data) top.add(x);
+        bench::keep(top.threshold());
+    }), items);
+    bench::report("TopK::add(block), threshold filter", bench::bestMs(3, [&] {
+        algo::TopK<int, K> top;
+        top.add(data);
+        bench::keep(top.threshold());
+    }), items);
+    bench::report("TopK, " + std::to_string(threads) + " threads + merge", bench::bestMs(3, [&] {
+        std::vector<algo::TopK<int, K>> parts(threads);
+        std::vector<std::thread> pool;
+        const std::size_t chunk = (n + threads - 1) / threads;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                std::size_t lo = std::min(n, t * chunk), hi = std::min(n, lo + chunk);
+                parts[t].add(data.data() + lo, hi - lo);
+            });
+        }
+        for (auto& th : pool) th.join();
+        for (int t = 1; t < threads; ++t) parts[0].merge(parts[t]);
+        bench::keep(parts[0].threshold());
+    }), items);
+    std::printf("(hardware threads: %u)\n", std::thread::hardware_concurrency());
+    return 0;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace algo {
+
+    // Lock-free union-find over elements 0..n-1 for concurrent use.
+    //
+    // find() does path halving with compare-and-swap, so concurrent finds
+    // only ever shorten paths and never corrupt them. merge() links roots
+    // by index (the smaller root under the larger one), which keeps parent
+    // pointers increasing along every path, so concurrent links cannot form
+    // a cycle. A failed CAS means another thread linked the root first, and
+    // merge() retries from the new roots.
+    //
+    // Compared with DisjointSet there is no union by size and no per-set
+    // attributes; the rank-free linking plus path halving is the usual
+    // trade for lock freedom (Anderson & Woll; Jayanti & Tarjan).
+    class ConcurrentDisjointSet {
+    public:
+        explicit ConcurrentDisjointSet(int n) : n_(n) {
+            if (n < 0) throw std::invalid_argument("ConcurrentDisjointSet: negative size");
+            parent_ = std::make_unique<std::atomic<int>[]>(n);
+            for (int i = 0; i < n; ++i) parent_[i].store(i, std::memory_order_relaxed);
+        }
+
+        int size() const { return n_; }
+
+        int find(int u) {
+            for (;;) {
+                int p = parent_[u].load(std::memory_order_acquire);
+                if (p == u) return u;
+                int gp = parent_[p].load(std::memory_order_acquire);
+                if (p != gp) parent_[u].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+                u = gp;
+            }
+        }
+
+        // Returns true if a and b were in different sets.
+        bool merge(int a, int b) {
+            for (;;) {
+                a = find(a);
+                b = find(b);
+                if (a == b) return false;
+                if (a > b) std::swap(a, b);
+                int expected = a;
+                if (parent_[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) return true;
+            }
+        }
+
+        // Linearizable: retries while the root of a is being linked.
+        bool sameSet(int a, int b) {
+            for (;;) {
+                a = find(a);
+                b = find(b);
+                if (a == b) return true;
+                if (parent_[a].load(std::memory_order_acquire) == a) return false;
+            }
+        }
+
+    private:
+        int n_;
+        std::unique_ptr<std::atomic<int>[]> parent_;
+    };
+
+} // namespace algo
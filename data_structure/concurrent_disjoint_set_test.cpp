@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include "concurrent_disjoint_set.hpp"
+#include "disjoint_set.hpp"
+#include "misc/thread_pool.hpp"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+TEST(ConcurrentDisjointSetTest, Basic) {
+    algo::ConcurrentDisjointSet dsu(6);
+    EXPECT_EQ(dsu.size(), 6);
+    EXPECT_FALSE(dsu.sameSet(0, 1));
+    EXPECT_TRUE(dsu.merge(0, 1));
+    EXPECT_TRUE(dsu.merge(2, 3));
+    EXPECT_FALSE(dsu.merge(1, 0));
+    EXPECT_TRUE(dsu.merge(1, 3));
+    EXPECT_TRUE(dsu.sameSet(0, 2));
+    EXPECT_FALSE(dsu.sameSet(0, 4));
+    EXPECT_EQ(dsu.find(0), dsu.find(3));
+    EXPECT_EQ(dsu.find(5), 5);
+    EXPECT_THROW(algo::ConcurrentDisjointSet(-1), std::invalid_argument);
+}
+
+TEST(ConcurrentDisjointSetTest, ConcurrentMergesMatchSequential) {
+    const int n = 20000, m = 30000;
+    std::mt19937 rng(3);
+    std::vector<std::pair<int, int>> pairs(m);
+    for (auto& [a, b] : pairs) {
+        a = rng() % n;
+        b = rng() % n;
+    }
+    algo::DisjointSet expected(n);
+    int expectedMerges = 0;
+    for (auto [a, b] : pairs) {
+        if (expected.find(a) != expected.find(b)) expectedMerges++;
+        expected.merge(a, b);
+    }
+
+    algo::ThreadPool pool(4);
+    algo::ConcurrentDisjointSet dsu(n);
+    std::vector<int> merges(pool.size(), 0);
+    pool.forEach(pairs.size(), [&](int worker, std::size_t i) {
+        if (dsu.merge(pairs[i].first, pairs[i].second)) merges[worker]++;
+    }, 64);
+
+    int total = 0;
+    for (int x : merges) total += x;
+    EXPECT_EQ(total, expectedMerges);
+    for (int i = 0; i < 2000; i++) {
+        int a = rng() % n, b = rng() % n;
+        EXPECT_EQ(dsu.sameSet(a, b), expected.find(a) == expected.find(b));
+    }
+}
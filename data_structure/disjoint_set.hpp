@@ -108,6 +108,24 @@ public:
     DSU_ATTRS
 #undef X
 
+    /*
+     * Call f(vec) on every attribute vector of DSU_ATTRS, in declaration order.
+     * Lets code outside this header (e.g. checkpointing) handle all attributes.
+     */
+    template <class F>
+    void forEachAttribute(F&& f) {
+#define X(Name, var, Type, init, merge_code) f(var);
+        DSU_ATTRS
+#undef X
+    }
+
+    template <class F>
+    void forEachAttribute(F&& f) const {
+#define X(Name, var, Type, init, merge_code) f(var);
+        DSU_ATTRS
+#undef X
+    }
+
     /*
      * Get size of the component containing u.
      */
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "disjoint_set.hpp"
+#include "misc/mapped_file.hpp"
+
+namespace algo {
+
+/*
+ * Bulk edge-list ingestion for DisjointSet.
+ *
+ * Edge files are memory-mapped and parsed in place:
+ *   - Text   : one "u v" pair per line. Extra columns (e.g. weights) are
+ *              ignored, lines starting with '#' or '%' are comments.
+ *   - Binary : consecutive native-endian int32 pairs (u, v).
+ *
+ * Edges are merged in batches. Before a batch is merged, the parent slots of
+ * all its endpoints and then of their parents are prefetched, so the cache
+ * misses of the following find() calls overlap instead of stalling one by one.
+ *
+ * Loading is resumable: every load returns the byte offset of the next unread
+ * edge, and saveCheckpoint()/loadCheckpoint() persist that offset together with
+ * the parent, size and per-set attribute (DSU_ATTRS) arrays. An edge with an
+ * out-of-range vertex throws EdgeRangeError, a malformed text line throws
+ * EdgeParseError; both are thrown after all edges before the bad one have been
+ * merged, and their offset() is where the load can be resumed once the line is
+ * fixed.
+ */
+enum class EdgeFileFormat { Text, Binary };
+
+struct EdgeLoadStats {
+    long long edges = 0;    // edges merged by this call
+    std::size_t offset = 0; // byte offset to resume from
+    double seconds = 0;     // wall time spent parsing and merging
+
+    double edgesPerSecond() const {
+        return seconds > 0 ? static_cast<double>(edges) / seconds : 0;
+    }
+};
+
+class EdgeRangeError : public std::out_of_range {
+public:
+    EdgeRangeError(const std::string& what, std::size_t offset, long long edges)
+        : std::out_of_range(what), offset_(offset), edges_(edges) {}
+
+    std::size_t offset() const { return offset_; } // byte offset of the bad edge
+    long long edges() const { return edges_; }     // edges merged before it
+
+private:
+    std::size_t offset_;
+    long long edges_;
+};
+
+class EdgeParseError : public std::runtime_error {
+public:
+    EdgeParseError(const std::string& what, std::size_t offset, long long edges)
+        : std::runtime_error(what), offset_(offset), edges_(edges) {}
+
+    std::size_t offset() const { return offset_; } // byte offset of the bad line
+    long long edges() const { return edges_; }     // edges merged before it
+
+private:
+    std::size_t offset_;
+    long long edges_;
+};
+
+class DisjointSetLoader {
+public:
+    explicit DisjointSetLoader(DisjointSet& dsu, int batch = 64)
+        : dsu_(dsu), batch_(batch > 0 ? batch : 1) {
+        us_.resize(batch_);
+        vs_.resize(batch_);
+    }
+
+    /*
+     * Merge the edges of a file, starting at byte `offset`.
+     * Stops after `maxEdges` edges when maxEdges >= 0.
+     */
+    EdgeLoadStats load(const std::string& path, EdgeFileFormat format,
+                       std::size_t offset = 0, long long maxEdges = -1) {
+        MappedFile file(path, MappedFile::Access::Sequential);
+        return loadBuffer(file.data(), file.size(), format, offset, maxEdges);
+    }
+
+    /*
+     * Same as load() but over an in-memory buffer.
+     */
+    EdgeLoadStats loadBuffer(const char* data, std::size_t size, EdgeFileFormat format,
+                             std::size_t offset = 0, long long maxEdges = -1) {
+        auto start = std::chrono::steady_clock::now();
+        EdgeLoadStats stats;
+
+        const char* p = data + std::min(offset, size);
+        const char* end = data + size;
+        for (;;) {
+            int cnt = 0;
+            while (cnt < batch_ && (maxEdges < 0 || stats.edges + cnt < maxEdges)) {
+                const char* at = p;
+                bool ok = false;
+                try {
+                    ok = format == EdgeFileFormat::Text
+                        ? nextTextEdge(p, end, data, us_[cnt], vs_[cnt])
+                        : nextBinaryEdge(p, end, us_[cnt], vs_[cnt]);
+                } catch (const EdgeParseError& e) {
+                    // Same contract as an out-of-range vertex.
+                    mergeBatch(cnt);
+                    throw EdgeParseError(e.what(), e.offset(), stats.edges + cnt);
+                }
+                if (!ok) break;
+                if (!inRange(us_[cnt]) || !inRange(vs_[cnt])) {
+                    // Keep the edges read so far, so the caller can resume at `at`.
+                    mergeBatch(cnt);
+                    int bad = inRange(us_[cnt]) ? vs_[cnt] : us_[cnt];
+                    throw EdgeRangeError("DisjointSetLoader: vertex " + std::to_string(bad) +
+                                             " out of range at byte " + std::to_string(at - data),
+                                         static_cast<std::size_t>(at - data), stats.edges + cnt);
+                }
+                ++cnt;
+            }
+            if (cnt == 0) break;
+            mergeBatch(cnt);
+            stats.edges += cnt;
+        }
+
+        stats.offset = static_cast<std::size_t>(p - data);
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+    /*
+     * Write parent/size/attribute arrays and the resume offset to `path`.
+     */
+    void saveCheckpoint(const std::string& path, std::size_t offset) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("DisjointSetLoader: cannot write " + path);
+
+        std::uint64_t n = dsu_.parent.size();
+        std::uint64_t off = offset;
+        std::uint64_t attrBytes = attributeBytes();
+        out.write(kMagic, sizeof(kMagic));
+        out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        out.write(reinterpret_cast<const char*>(&off), sizeof(off));
+        out.write(reinterpret_cast<const char*>(&attrBytes), sizeof(attrBytes));
+        writeArray(out, dsu_.parent);
+        writeArray(out, dsu_.size);
+        dsu_.forEachAttribute([&](const auto& v) { writeArray(out, v); });
+        if (!out) throw std::runtime_error("DisjointSetLoader: short write to " + path);
+    }
+
+    /*
+     * Restore parent/size/attribute arrays from `path` and return the saved
+     * resume offset. The DisjointSet must have been constructed with the same
+     * number of elements and the same DSU_ATTRS.
+     */
+    std::size_t loadCheckpoint(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("DisjointSetLoader: cannot open " + path);
+
+        char magic[sizeof(kMagic)];
+        std::uint64_t n = 0, off = 0, attrBytes = 0;
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(&n), sizeof(n));
+        in.read(reinterpret_cast<char*>(&off), sizeof(off));
+        in.read(reinterpret_cast<char*>(&attrBytes), sizeof(attrBytes));
+        if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("DisjointSetLoader: bad checkpoint " + path);
+        }
+        if (n != dsu_.parent.size()) {
+            throw std::runtime_error("DisjointSetLoader: checkpoint size mismatch");
+        }
+        if (attrBytes != attributeBytes()) {
+            throw std::runtime_error("DisjointSetLoader: checkpoint attribute layout mismatch");
+        }
+        readArray(in, dsu_.parent);
+        readArray(in, dsu_.size);
+        dsu_.forEachAttribute([&](auto& v) { readArray(in, v); });
+        if (!in) throw std::runtime_error("DisjointSetLoader: truncated checkpoint " + path);
+        return static_cast<std::size_t>(off);
+    }
+
+private:
+    static constexpr char kMagic[8] = {'D', 'S', 'U', 'C', 'K', 'P', 'T', '2'};
+
+    DisjointSet& dsu_;
+    int batch_;
+    std::vector<int> us_, vs_;
+
+    static void prefetch(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(addr);
+#else
+        (void)addr;
+#endif
+    }
+
+    bool inRange(int u) const {
+        return u >= 0 && u < static_cast<int>(dsu_.parent.size());
+    }
+
+    // Bytes per element over all DSU_ATTRS vectors; a cheap layout fingerprint.
+    std::uint64_t attributeBytes() const {
+        std::uint64_t bytes = 0;
+        dsu_.forEachAttribute([&](const auto& v) { bytes += sizeof(typename std::decay_t<decltype(v)>::value_type); });
+        return bytes;
+    }
+
+    template <class T>
+    static void writeArray(std::ofstream& out, const std::vector<T>& v) {
+        out.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    template <class T>
+    static void readArray(std::ifstream& in, std::vector<T>& v) {
+        in.read(reinterpret_cast<char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    void mergeBatch(int cnt) {
+        auto& parent = dsu_.parent;
+        for (int i = 0; i < cnt; ++i) {
+            prefetch(&parent[us_[i]]);
+            prefetch(&parent[vs_[i]]);
+        }
+        // One more hop of each find chain; after path compression most chains
+        // are at most this long.
+        for (int i = 0; i < cnt; ++i) {
+            prefetch(&parent[parent[us_[i]]]);
+            prefetch(&parent[parent[vs_[i]]]);
+        }
+        for (int i = 0; i < cnt; ++i) {
+            dsu_.merge(us_[i], vs_[i]);
+        }
+    }
+
+    static bool nextBinaryEdge(const char*& p, const char* end, int& u, int& v) {
+        if (end - p < static_cast<std::ptrdiff_t>(2 * sizeof(std::int32_t))) return false;
+        std::int32_t buf[2];
+        std::memcpy(buf, p, sizeof(buf));
+        p += sizeof(buf);
+        u = buf[0];
+        v = buf[1];
+        return true;
+    }
+
+    static bool nextTextEdge(const char*& p, const char* end, const char* base, int& u, int& v) {
+        for (;;) {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) ++p;
+            if (p == end) return false;
+            if (*p != '#' && *p != '%') break;
+            while (p < end && *p != '\n') ++p;
+        }
+
+        const char* line = p;
+        auto r = std::from_chars(p, end, u);
+        if (r.ec == std::errc()) {
+            p = r.ptr;
+            while (p < end && (*p == ' ' || *p == '\t')) ++p;
+            r = std::from_chars(p, end, v);
+        }
+        if (r.ec != std::errc()) {
+            throw EdgeParseError("DisjointSetLoader: malformed edge at byte " + std::to_string(line - base),
+                                 static_cast<std::size_t>(line - base), 0);
+        }
+        p = r.ptr;
+        while (p < end && *p != '\n') ++p;
+        if (p < end) ++p;
+        return true;
+    }
+};
+
+} // namespace algo
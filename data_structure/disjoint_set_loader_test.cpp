@@ -0,0 +1,186 @@
+#include "gtest/gtest.h"
+#include "disjoint_set_loader.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string tempPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    void writeFile(const std::string& path, const std::string& content) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << content;
+    }
+}
+
+TEST(DisjointSetLoaderTest, TextEdgeList) {
+    const std::string path = tempPath("algo_dsu_loader_text.txt");
+    writeFile(path,
+              "# comment line\n"
+              "1 2\n"
+              "2\t3 17\n"
+              "\n"
+              "% another comment\n"
+              "5 6\r\n"
+              "7 5");
+
+    algo::DisjointSet dsu(8);
+    algo::DisjointSetLoader loader(dsu, 2);
+    auto stats = loader.load(path, algo::EdgeFileFormat::Text);
+
+    EXPECT_EQ(stats.edges, 4);
+    EXPECT_EQ(dsu.getSize(1), 3);
+    EXPECT_EQ(dsu.find(3), dsu.find(1));
+    EXPECT_EQ(dsu.getSize(7), 3);
+    EXPECT_NE(dsu.find(1), dsu.find(5));
+    EXPECT_EQ(dsu.getSize(4), 1);
+    EXPECT_GE(stats.edgesPerSecond(), 0.0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(DisjointSetLoaderTest, BinaryEdgeList) {
+    const std::string path = tempPath("algo_dsu_loader_bin.dat");
+    std::vector<std::int32_t> raw = {0, 1, 1, 2, 3, 4};
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(raw.data()), raw.size() * sizeof(std::int32_t));
+    }
+
+    algo::DisjointSet dsu(4);
+    algo::DisjointSetLoader loader(dsu);
+    auto stats = loader.load(path, algo::EdgeFileFormat::Binary);
+
+    EXPECT_EQ(stats.edges, 3);
+    EXPECT_EQ(stats.offset, raw.size() * sizeof(std::int32_t));
+    EXPECT_EQ(dsu.getSize(0), 3);
+    EXPECT_EQ(dsu.getSize(3), 2);
+
+    std::filesystem::remove(path);
+}
+
+TEST(DisjointSetLoaderTest, ResumeFromCheckpoint) {
+    std::string text;
+    for (int i = 1; i < 50; ++i) {
+        text += std::to_string(i) + " " + std::to_string(i + 1) + "\n";
+    }
+
+    algo::DisjointSet first(50);
+    algo::DisjointSetLoader firstLoader(first, 8);
+    auto part = firstLoader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, 0, 20);
+    EXPECT_EQ(part.edges, 20);
+    EXPECT_EQ(first.getSize(1), 21);
+
+    const std::string ckpt = tempPath("algo_dsu_loader.ckpt");
+    firstLoader.saveCheckpoint(ckpt, part.offset);
+
+    algo::DisjointSet second(50);
+    algo::DisjointSetLoader secondLoader(second, 8);
+    std::size_t offset = secondLoader.loadCheckpoint(ckpt);
+    EXPECT_EQ(offset, part.offset);
+    EXPECT_EQ(second.getSize(1), 21);
+
+    auto rest = secondLoader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, offset);
+    EXPECT_EQ(rest.edges, 29);
+    EXPECT_EQ(second.getSize(1), 50);
+
+    algo::DisjointSet wrongSize(10);
+    algo::DisjointSetLoader wrongLoader(wrongSize);
+    EXPECT_THROW(wrongLoader.loadCheckpoint(ckpt), std::runtime_error);
+
+    std::filesystem::remove(ckpt);
+}
+
+TEST(DisjointSetLoaderTest, CheckpointKeepsAttributes) {
+    const std::string text = "1 2\n3 4\n";
+
+    algo::DisjointSet first(4);
+    for (int i = 1; i <= 4; ++i) first.setValue(i, i * 10);
+    algo::DisjointSetLoader firstLoader(first);
+    auto part = firstLoader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, 0, 1);
+
+    const std::string ckpt = tempPath("algo_dsu_loader_attrs.ckpt");
+    firstLoader.saveCheckpoint(ckpt, part.offset);
+
+    algo::DisjointSet second(4);
+    algo::DisjointSetLoader secondLoader(second);
+    std::size_t offset = secondLoader.loadCheckpoint(ckpt);
+    EXPECT_EQ(second.getSum(1), 30);
+    EXPECT_EQ(second.getMax(2), 20);
+    EXPECT_EQ(second.getMin(2), 10);
+    EXPECT_EQ(second.getSum(3), 30);
+
+    secondLoader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, offset);
+    EXPECT_EQ(second.getSum(3), 70);
+    EXPECT_EQ(second.getMin(4), 30);
+
+    std::filesystem::remove(ckpt);
+}
+
+TEST(DisjointSetLoaderTest, ResumeAfterOutOfRangeVertex) {
+    const std::string text = "1 2\n2 3\n1 9\n4 5\n";
+
+    algo::DisjointSet dsu(5);
+    algo::DisjointSetLoader loader(dsu, 8);
+    std::size_t offset = 0;
+    try {
+        loader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text);
+        FAIL() << "expected EdgeRangeError";
+    } catch (const algo::EdgeRangeError& e) {
+        EXPECT_EQ(e.offset(), 8u);
+        EXPECT_EQ(e.edges(), 2);
+        offset = e.offset();
+    }
+    // Edges before the bad line are already merged.
+    EXPECT_EQ(dsu.getSize(1), 3);
+
+    // Skip the bad line and carry on.
+    offset = text.find('\n', offset) + 1;
+    auto rest = loader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, offset);
+    EXPECT_EQ(rest.edges, 1);
+    EXPECT_EQ(dsu.getSize(4), 2);
+}
+
+TEST(DisjointSetLoaderTest, ResumeAfterMalformedLine) {
+    // The bad line is in the middle of the first batch.
+    const std::string text = "1 2\n2 3\n3 x\n4 5\n";
+
+    algo::DisjointSet dsu(6);
+    algo::DisjointSetLoader loader(dsu, 8);
+    std::size_t offset = 0;
+    try {
+        loader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text);
+        FAIL() << "expected EdgeParseError";
+    } catch (const algo::EdgeParseError& e) {
+        EXPECT_EQ(e.offset(), 8u);
+        EXPECT_EQ(e.edges(), 2);
+        offset = e.offset();
+    }
+    EXPECT_EQ(dsu.getSize(1), 3);
+
+    offset = text.find('\n', offset) + 1;
+    auto rest = loader.loadBuffer(text.data(), text.size(), algo::EdgeFileFormat::Text, offset);
+    EXPECT_EQ(rest.edges, 1);
+    EXPECT_EQ(dsu.getSize(4), 2);
+}
+
+TEST(DisjointSetLoaderTest, RejectsBadInput) {
+    algo::DisjointSet dsu(3);
+    algo::DisjointSetLoader loader(dsu);
+
+    const std::string outOfRange = "1 9\n";
+    EXPECT_THROW(loader.loadBuffer(outOfRange.data(), outOfRange.size(), algo::EdgeFileFormat::Text),
+                 std::out_of_range);
+
+    const std::string malformed = "1 x\n";
+    EXPECT_THROW(loader.loadBuffer(malformed.data(), malformed.size(), algo::EdgeFileFormat::Text),
+                 std::runtime_error);
+
+    EXPECT_THROW(loader.load(tempPath("algo_dsu_loader_missing.txt"), algo::EdgeFileFormat::Text),
+                 std::runtime_error);
+}
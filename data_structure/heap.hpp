@@ -1,66 +1,150 @@
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <functional>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace algo {
 
+    // Default heap ordering: min-heap unless constructed with isMinHeap = false.
+    // Compares directly instead of negating keys, so it works for unsigned and
+    // non-numeric T and cannot overflow.
     template <typename T>
+    struct HeapOrder {
+        bool isMinHeap = true;
+
+        bool operator()(const T& a, const T& b) const {
+            return isMinHeap ? a < b : b < a;
+        }
+    };
+
+    // d-ary heap.
+    //
+    // Template parameters:
+    //   T       : element type, may be move-only
+    //   Compare : comp(a, b) == true means a leaves the heap before b
+    //   Arity   : children per node (2, 4 and 8 are the useful choices)
+    //
+    // Sifting moves a hole instead of swapping, so every level costs one move.
+    template <typename T, typename Compare = HeapOrder<T>, int Arity = 2>
     class Heap {
+        static_assert(Arity >= 2, "Heap arity must be at least 2.");
+
     public:
-        int size() {
-            return arr.size();
+        Heap(bool isMinHeap = true) requires std::is_same_v<Compare, HeapOrder<T>>
+            : comp(HeapOrder<T>{isMinHeap}) {}
+
+        Heap() requires (!std::is_same_v<Compare, HeapOrder<T>>) {}
+
+        explicit Heap(Compare comp) : comp(std::move(comp)) {}
+
+        // O(n) heapify.
+        explicit Heap(std::vector<T> items, Compare comp = Compare())
+            : comp(std::move(comp)), arr(std::move(items)) {
+            if (arr.size() < 2) return;
+            for (std::size_t i = parent(arr.size() - 1) + 1; i-- > 0;) {
+                sink(i);
+            }
+        }
+
+        int size() const {
+            return static_cast<int>(arr.size());
+        }
+
+        bool empty() const {
+            return arr.empty();
         }
 
-        Heap(bool isMinHeap = true) {
-            symbol = isMinHeap ? 1 : -1;
+        void reserve(std::size_t capacity) {
+            arr.reserve(capacity);
         }
 
-        T top() {
+        const T& top() const {
             if (arr.empty()) throw std::out_of_range("Topping on empty heap.");
-            return arr[0] * symbol;
+            return arr[0];
         }
 
         T pop() {
             if (arr.empty()) throw std::out_of_range("Popping on empty heap.");
-            T ret = arr[0] * symbol;
-            arr[0] = *--arr.end();
-            arr.pop_back();
-            sink(0);
+            T ret = std::move(arr[0]);
+            if (arr.size() > 1) {
+                arr[0] = std::move(arr.back());
+                arr.pop_back();
+                sink(0);
+            } else {
+                arr.pop_back();
+            }
             return ret;
         }
 
         void add(T x) {
-            arr.push_back(x * symbol);
+            arr.push_back(std::move(x));
+            _float(arr.size() - 1);
+        }
+
+        // Pop the top and add x with a single sift; returns the old top.
+        T replaceTop(T x) {
+            if (arr.empty()) throw std::out_of_range("replaceTop on empty heap.");
+            T ret = std::move(arr[0]);
+            arr[0] = std::move(x);
+            sink(0);
+            return ret;
+        }
+
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            arr.emplace_back(std::forward<Args>(args)...);
             _float(arr.size() - 1);
         }
+
+        void clear() {
+            arr.clear();
+        }
+
     private:
-        short symbol;
+        Compare comp{};
         std::vector<T> arr;
 
-        bool greater(int a, int b) {
-            if (b >= arr.size()) return false;
-            return arr[a] > arr[b];
+        static std::size_t parent(std::size_t pos) {
+            return (pos - 1) / Arity;
         }
 
-        void sink(int pos) {
-            while (greater(pos, pos * 2 + 1) || greater(pos, pos * 2 + 2)) {
-                if (greater(pos * 2 + 1, pos * 2 + 2)) {
-                    std::swap(arr[pos], arr[pos * 2 + 2]);
-                    pos = pos * 2 + 2;
-                } else {
-                    std::swap(arr[pos], arr[pos * 2 + 1]);
-                    pos = pos * 2 + 1;
+        void sink(std::size_t pos) {
+            const std::size_t n = arr.size();
+            T value = std::move(arr[pos]);
+            for (;;) {
+                std::size_t first = pos * Arity + 1;
+                if (first >= n) break;
+                std::size_t last = first + Arity < n ? first + Arity : n;
+                std::size_t best = first;
+                for (std::size_t c = first + 1; c < last; ++c) {
+                    if (comp(arr[c], arr[best])) best = c;
                 }
+                if (!comp(arr[best], value)) break;
+                arr[pos] = std::move(arr[best]);
+                pos = best;
             }
+            arr[pos] = std::move(value);
         }
 
-        void _float(int pos) {
-            while (pos > 0 && arr[pos] < arr[(pos - 1) >> 1]) {
-                std::swap(arr[pos], arr[(pos - 1) >> 1]);
-                pos = (pos - 1) >> 1;
+        void _float(std::size_t pos) {
+            T value = std::move(arr[pos]);
+            while (pos > 0 && comp(value, arr[parent(pos)])) {
+                arr[pos] = std::move(arr[parent(pos)]);
+                pos = parent(pos);
             }
+            arr[pos] = std::move(value);
         }
     };
+
+    // Statically ordered heaps; no runtime direction check in the comparator.
+    template <typename T, int Arity = 2>
+    using MinHeap = Heap<T, std::less<T>, Arity>;
+
+    template <typename T, int Arity = 2>
+    using MaxHeap = Heap<T, std::greater<T>, Arity>;
 }
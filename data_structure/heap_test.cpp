@@ -1,6 +1,12 @@
 #include "gtest/gtest.h"
 #include "heap.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
 TEST(HeapTest, MinHeapBasic) {
     algo::Heap<int> h(true);  // min-heap
 
@@ -93,3 +99,72 @@ TEST(HeapTest, MixedOperations) {
 
     EXPECT_THROW(h.top(), std::out_of_range);
 }
+
+
+TEST(HeapTest, UnsignedAndExtremeKeys) {
+    algo::Heap<unsigned> h(false);  // max-heap; negation would wrap around
+    h.add(0u);
+    h.add(4000000000u);
+    h.add(7u);
+    EXPECT_EQ(h.pop(), 4000000000u);
+    EXPECT_EQ(h.pop(), 7u);
+    EXPECT_EQ(h.pop(), 0u);
+
+    algo::Heap<int> g(false);
+    g.add(std::numeric_limits<int>::min());
+    g.add(0);
+    EXPECT_EQ(g.pop(), 0);
+    EXPECT_EQ(g.pop(), std::numeric_limits<int>::min());
+}
+
+TEST(HeapTest, HeapifyMatchesSort) {
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i) values.push_back((i * 7919) % 1009);
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    algo::MinHeap<int, 4> h(values);
+    EXPECT_EQ(h.size(), 1000);
+    for (int v : sorted) EXPECT_EQ(h.pop(), v);
+    EXPECT_TRUE(h.empty());
+}
+
+TEST(HeapTest, CustomCompareAndArity) {
+    struct Task {
+        std::string name;
+        int priority;
+    };
+    auto byPriority = [](const Task& a, const Task& b) { return a.priority > b.priority; };
+    algo::Heap<Task, decltype(byPriority), 8> h(byPriority);
+    h.reserve(16);
+
+    h.emplace(Task{"low", 1});
+    h.emplace(Task{"high", 9});
+    h.add(Task{"mid", 5});
+
+    EXPECT_EQ(h.top().name, "high");
+    EXPECT_EQ(h.pop().name, "high");
+    EXPECT_EQ(h.pop().name, "mid");
+    EXPECT_EQ(h.pop().name, "low");
+}
+
+TEST(HeapTest, MoveOnlyElements) {
+    algo::Heap<std::unique_ptr<int>, bool (*)(const std::unique_ptr<int>&, const std::unique_ptr<int>&)> h(
+        [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; });
+
+    for (int x : {5, 3, 8, 1}) h.emplace(std::make_unique<int>(x));
+    EXPECT_EQ(*h.top(), 1);
+
+    std::vector<int> out;
+    while (!h.empty()) out.push_back(*h.pop());
+    EXPECT_EQ(out, (std::vector<int>{1, 3, 5, 8}));
+}
+
+TEST(HeapTest, ReplaceTop) {
+    algo::MinHeap<int> h(std::vector<int>{4, 2, 6});
+    EXPECT_EQ(h.replaceTop(5), 2);
+    EXPECT_EQ(h.pop(), 4);
+    EXPECT_EQ(h.pop(), 5);
+    EXPECT_EQ(h.pop(), 6);
+    EXPECT_THROW(h.replaceTop(1), std::out_of_range);
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+    // Addressable d-ary heap over ids 0..n-1.
+    //
+    // Every id is in the heap at most once with one key, and a position array
+    // maps ids to heap slots, so keys can be changed in place instead of
+    // pushing duplicates:
+    //   push(id, key), decreaseKey(id, key), increaseKey(id, key),
+    //   erase(id), contains(id)  -- O(log n)
+    //
+    // "Decrease" means moving towards the top: after decreaseKey(id, key)
+    // the new key must not compare after the old one under Compare.
+    //
+    // reset() empties the heap in time proportional to the ids touched since
+    // the last reset, so one instance can serve many runs (e.g. repeated
+    // Dijkstra queries) without reallocating or clearing O(n) state.
+    template <typename Key, typename Compare = std::less<Key>, int Arity = 4>
+    class IndexedHeap {
+        static_assert(Arity >= 2, "IndexedHeap arity must be at least 2.");
+
+    public:
+        explicit IndexedHeap(int n = 0, Compare comp = Compare())
+            : comp_(std::move(comp)), pos_(n, kAbsent) {}
+
+        // Grow the id range to 0..n-1. Existing entries are kept.
+        void resize(int n) {
+            if (n > static_cast<int>(pos_.size())) pos_.resize(n, kAbsent);
+        }
+
+        int capacity() const { return static_cast<int>(pos_.size()); }
+        int size() const { return static_cast<int>(heap_.size()); }
+        bool empty() const { return heap_.empty(); }
+
+        bool contains(int id) const {
+            checkId(id);
+            return pos_[id] >= 0;
+        }
+
+        const Key& key(int id) const {
+            requireContained(id);
+            return heap_[pos_[id]].key;
+        }
+
+        int top() const {
+            if (heap_.empty()) throw std::out_of_range("Topping on empty heap.");
+            return heap_[0].id;
+        }
+
+        const Key& topKey() const {
+            if (heap_.empty()) throw std::out_of_range("Topping on empty heap.");
+            return heap_[0].key;
+        }
+
+        // Remove the top entry and return its id.
+        int pop() {
+            if (heap_.empty()) throw std::out_of_range("Popping on empty heap.");
+            int id = heap_[0].id;
+            removeAt(0);
+            return id;
+        }
+
+        void push(int id, Key key) {
+            checkId(id);
+            if (pos_[id] >= 0) throw std::invalid_argument("IndexedHeap: id " + std::to_string(id) + " already present");
+            if (pos_[id] == kAbsent) touched_.push_back(id);
+            heap_.push_back({std::move(key), id});
+            siftUp(heap_.size() - 1);
+        }
+
+        void decreaseKey(int id, Key key) {
+            requireContained(id);
+            std::size_t p = pos_[id];
+            heap_[p].key = std::move(key);
+            siftUp(p);
+        }
+
+        void increaseKey(int id, Key key) {
+            requireContained(id);
+            std::size_t p = pos_[id];
+            heap_[p].key = std::move(key);
+            siftDown(p);
+        }
+
+        // Insert id, or move it to `key` in whichever direction is needed.
+        void update(int id, Key key) {
+            checkId(id);
+            if (pos_[id] < 0) {
+                push(id, std::move(key));
+                return;
+            }
+            std::size_t p = pos_[id];
+            bool up = comp_(key, heap_[p].key);
+            heap_[p].key = std::move(key);
+            if (up) siftUp(p);
+            else siftDown(p);
+        }
+
+        void erase(int id) {
+            requireContained(id);
+            removeAt(pos_[id]);
+        }
+
+        // Empty the heap, touching only ids used since the previous reset.
+        void reset() {
+            for (int id : touched_) pos_[id] = kAbsent;
+            touched_.clear();
+            heap_.clear();
+        }
+
+    private:
+        // pos_ values below zero: never pushed since reset / pushed then removed.
+        static constexpr int kAbsent = -1;
+        static constexpr int kRemoved = -2;
+
+        struct Entry {
+            Key key;
+            int id;
+        };
+
+        Compare comp_;
+        std::vector<Entry> heap_;
+        std::vector<int> pos_;
+        std::vector<int> touched_;
+
+        void checkId(int id) const {
+            if (id < 0 || id >= static_cast<int>(pos_.size())) {
+                throw std::out_of_range("IndexedHeap: id " + std::to_string(id) + " out of range");
+            }
+        }
+
+        void requireContained(int id) const {
+            checkId(id);
+            if (pos_[id] < 0) throw std::invalid_argument("IndexedHeap: id " + std::to_string(id) + " not present");
+        }
+
+        void removeAt(std::size_t p) {
+            pos_[heap_[p].id] = kRemoved;
+            if (p + 1 == heap_.size()) {
+                heap_.pop_back();
+                return;
+            }
+            heap_[p] = std::move(heap_.back());
+            heap_.pop_back();
+            pos_[heap_[p].id] = static_cast<int>(p);
+            if (p > 0 && comp_(heap_[p].key, heap_[(p - 1) / Arity].key)) siftUp(p);
+            else siftDown(p);
+        }
+
+        void place(std::size_t p, Entry&& e) {
+            pos_[e.id] = static_cast<int>(p);
+            heap_[p] = std::move(e);
+        }
+
+        void siftUp(std::size_t p) {
+            Entry e = std::move(heap_[p]);
+            while (p > 0) {
+                std::size_t parent = (p - 1) / Arity;
+                if (!comp_(e.key, heap_[parent].key)) break;
+                place(p, std::move(heap_[parent]));
+                p = parent;
+            }
+            place(p, std::move(e));
+        }
+
+        void siftDown(std::size_t p) {
+            const std::size_t n = heap_.size();
+            Entry e = std::move(heap_[p]);
+            for (;;) {
+                std::size_t first = p * Arity + 1;
+                if (first >= n) break;
+                std::size_t last = first + Arity < n ? first + Arity : n;
+                std::size_t best = first;
+                for (std::size_t c = first + 1; c < last; ++c) {
+                    if (comp_(heap_[c].key, heap_[best].key)) best = c;
+                }
+                if (!comp_(heap_[best].key, e.key)) break;
+                place(p, std::move(heap_[best]));
+                p = best;
+            }
+            place(p, std::move(e));
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+#include "indexed_heap.hpp"
+
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+TEST(IndexedHeapTest, Basic) {
+    algo::IndexedHeap<int> h(6);
+
+    h.push(0, 50);
+    h.push(1, 20);
+    h.push(2, 40);
+    h.push(3, 10);
+    EXPECT_EQ(h.size(), 4);
+    EXPECT_EQ(h.top(), 3);
+    EXPECT_EQ(h.topKey(), 10);
+
+    h.decreaseKey(0, 5);
+    EXPECT_EQ(h.top(), 0);
+    EXPECT_EQ(h.key(0), 5);
+
+    h.increaseKey(0, 45);
+    EXPECT_EQ(h.top(), 3);
+
+    h.erase(3);
+    EXPECT_FALSE(h.contains(3));
+    EXPECT_TRUE(h.contains(2));
+
+    EXPECT_EQ(h.pop(), 1);
+    EXPECT_EQ(h.pop(), 2);
+    EXPECT_EQ(h.pop(), 0);
+    EXPECT_TRUE(h.empty());
+
+    EXPECT_THROW(h.pop(), std::out_of_range);
+    EXPECT_THROW(h.push(6, 1), std::out_of_range);
+    EXPECT_THROW(h.decreaseKey(1, 0), std::invalid_argument);
+    h.push(4, 1);
+    EXPECT_THROW(h.push(4, 2), std::invalid_argument);
+}
+
+TEST(IndexedHeapTest, MaxOrderAndUpdate) {
+    algo::IndexedHeap<long long, std::greater<long long>, 2> h(4);
+    h.update(0, 3);
+    h.update(1, 7);
+    h.update(2, 5);
+    EXPECT_EQ(h.top(), 1);
+
+    h.update(0, 9);  // towards the top
+    EXPECT_EQ(h.top(), 0);
+    h.update(0, 1);  // away from the top
+    EXPECT_EQ(h.top(), 1);
+
+    EXPECT_EQ(h.pop(), 1);
+    EXPECT_EQ(h.pop(), 2);
+    EXPECT_EQ(h.pop(), 0);
+}
+
+TEST(IndexedHeapTest, ResetOnlyClearsTouchedIds) {
+    algo::IndexedHeap<int> h(100);
+    h.push(10, 1);
+    h.push(20, 2);
+    h.pop();
+    h.reset();
+
+    EXPECT_TRUE(h.empty());
+    EXPECT_FALSE(h.contains(10));
+    EXPECT_FALSE(h.contains(20));
+
+    h.push(10, 3);
+    h.push(20, 1);
+    EXPECT_EQ(h.pop(), 20);
+    EXPECT_EQ(h.pop(), 10);
+}
+
+TEST(IndexedHeapTest, RandomAgainstSet) {
+    const int n = 200;
+    std::mt19937 rng(12345);
+    algo::IndexedHeap<int, std::less<int>, 8> h(n);
+    std::set<std::pair<int, int>> ref;
+    std::map<int, int> keys;
+
+    for (int step = 0; step < 20000; ++step) {
+        int id = static_cast<int>(rng() % n);
+        int key = static_cast<int>(rng() % 1000);
+        switch (rng() % 4) {
+        case 0:
+            if (!keys.count(id)) {
+                h.push(id, key);
+                keys[id] = key;
+                ref.insert({key, id});
+            }
+            break;
+        case 1:
+            if (keys.count(id)) {
+                ref.erase({keys[id], id});
+                h.update(id, key);
+                keys[id] = key;
+                ref.insert({key, id});
+            }
+            break;
+        case 2:
+            if (keys.count(id)) {
+                ref.erase({keys[id], id});
+                keys.erase(id);
+                h.erase(id);
+            }
+            break;
+        default:
+            if (!ref.empty()) {
+                EXPECT_EQ(h.topKey(), ref.begin()->first);
+                int top = h.pop();
+                ref.erase({keys[top], top});
+                keys.erase(top);
+            }
+            break;
+        }
+        ASSERT_EQ(h.size(), static_cast<int>(ref.size()));
+    }
+}
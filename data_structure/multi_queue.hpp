@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "heap.hpp"
+
+namespace algo {
+
+    // Relaxed concurrent min-priority queue (MultiQueue).
+    //
+    // c * threads independent d-ary heaps, each behind its own mutex that is
+    // only ever try-locked on the fast path:
+    //   - push : insert into a random heap that is not currently locked.
+    //   - pop  : look at the cached tops of two random heaps and pop from the
+    //            one with the smaller key.
+    // Contention stays low because threads rarely pick the same heap, at the
+    // price of relaxed ordering: pop returns an element whose rank among all
+    // queued keys is small in expectation (O(number of heaps)), not always the
+    // minimum. Suited to branch-and-bound and event workers that tolerate it.
+    //
+    // tryPop() only returns nullopt after a locked scan of every heap found
+    // nothing, so it never misses elements that were pushed before the call.
+    template <typename Key, typename Value, int Arity = 8>
+    class MultiQueue {
+        static_assert(std::is_arithmetic_v<Key>, "MultiQueue keys must be arithmetic.");
+
+    public:
+        explicit MultiQueue(int threads, int c = 2)
+            : count_(std::max(2, threads * c)), queues_(new Queue[count_]) {}
+
+        MultiQueue(const MultiQueue&) = delete;
+        MultiQueue& operator=(const MultiQueue&) = delete;
+
+        int queues() const { return count_; }
+
+        // Number of queued elements; exact only when no operation is running.
+        long long size() const { return size_.load(std::memory_order_relaxed); }
+        bool empty() const { return size() == 0; }
+
+        void push(Key key, Value value) {
+            for (;;) {
+                Queue& q = queues_[random() % count_];
+                std::unique_lock lock(q.mutex, std::try_to_lock);
+                if (!lock.owns_lock()) continue;
+                q.heap.add(Entry{key, std::move(value)});
+                q.top.store(q.heap.top().key, std::memory_order_relaxed);
+                q.filled.store(true, std::memory_order_relaxed);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        std::optional<std::pair<Key, Value>> tryPop() {
+            for (int attempt = 0; attempt < kAttempts; ++attempt) {
+                int i = static_cast<int>(random() % count_);
+                int j = static_cast<int>(random() % count_);
+                bool fi = queues_[i].filled.load(std::memory_order_relaxed);
+                bool fj = queues_[j].filled.load(std::memory_order_relaxed);
+                Key ki = queues_[i].top.load(std::memory_order_relaxed);
+                Key kj = queues_[j].top.load(std::memory_order_relaxed);
+                if (!fi || (fj && kj < ki)) {
+                    std::swap(i, j);
+                    std::swap(fi, fj);
+                }
+                if (!fi) {
+                    if (empty()) break;
+                    continue;
+                }
+
+                Queue& q = queues_[i];
+                std::unique_lock lock(q.mutex, std::try_to_lock);
+                if (!lock.owns_lock() || q.heap.empty()) continue;
+                return popLocked(q);
+            }
+
+            // Slow path: blocking scan so that an empty result is reliable.
+            for (int i = 0; i < count_; ++i) {
+                Queue& q = queues_[i];
+                std::lock_guard lock(q.mutex);
+                if (!q.heap.empty()) return popLocked(q);
+            }
+            return std::nullopt;
+        }
+
+    private:
+        static constexpr int kAttempts = 64;
+
+        struct Entry {
+            Key key;
+            Value value;
+        };
+
+        struct EntryLess {
+            bool operator()(const Entry& a, const Entry& b) const { return a.key < b.key; }
+        };
+
+        // One cache line per queue header to avoid false sharing of the locks.
+        // top is only meaningful while filled is set; a separate flag keeps
+        // every Key value, including max(), usable as a key.
+        struct alignas(64) Queue {
+            std::mutex mutex;
+            std::atomic<bool> filled{false};
+            std::atomic<Key> top{};
+            Heap<Entry, EntryLess, Arity> heap;
+        };
+
+        int count_;
+        std::unique_ptr<Queue[]> queues_;
+        std::atomic<long long> size_{0};
+
+        std::pair<Key, Value> popLocked(Queue& q) {
+            Entry e = q.heap.pop();
+            if (q.heap.empty()) q.filled.store(false, std::memory_order_relaxed);
+            else q.top.store(q.heap.top().key, std::memory_order_relaxed);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            return {e.key, std::move(e.value)};
+        }
+
+        // Per-thread xorshift generator; cheap enough for every operation.
+        static std::uint64_t random() {
+            thread_local std::uint64_t state =
+                std::hash<std::thread::id>{}(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ull | 1;
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+    };
+
+} // namespace algo
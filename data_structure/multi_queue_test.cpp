@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "multi_queue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST(MultiQueueTest, SingleThreadDrains) {
+    algo::MultiQueue<int, int> q(1);
+    for (int i = 0; i < 100; ++i) q.push(i, -i);
+    EXPECT_EQ(q.size(), 100);
+
+    std::vector<int> keys;
+    while (auto e = q.tryPop()) {
+        EXPECT_EQ(e->first, -e->second);
+        keys.push_back(e->first);
+    }
+    EXPECT_TRUE(q.empty());
+    std::sort(keys.begin(), keys.end());
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(keys[i], i);
+}
+
+TEST(MultiQueueTest, PopPrefersSmallKeys) {
+    // With only two heaps the relaxed order stays close to sorted:
+    // the first pops come from the smallest half.
+    algo::MultiQueue<long long, int> q(1, 2);
+    for (int i = 0; i < 1000; ++i) q.push(i, i);
+    long long sum = 0;
+    for (int i = 0; i < 10; ++i) sum += q.tryPop()->first;
+    EXPECT_LT(sum, 10 * 500);
+}
+
+TEST(MultiQueueTest, ExtremeKeys) {
+    using Limits = std::numeric_limits<int>;
+    algo::MultiQueue<int, int> q(2);
+    q.push(Limits::max(), 1);
+    q.push(Limits::lowest(), 2);
+    q.push(Limits::max(), 3);
+
+    std::vector<int> values;
+    while (auto e = q.tryPop()) values.push_back(e->second);
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(MultiQueueTest, RankErrorBound) {
+    // Two-choice pops keep the expected rank of the popped key O(#heaps).
+    const int n = 20000, pops = 10000;
+    algo::MultiQueue<int, int> q(4);
+    std::mt19937 rng(7);
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    for (int k : keys) q.push(k, k);
+
+    // Fenwick tree over keys still queued, to get the rank of each pop.
+    std::vector<int> bit(n + 1, 0);
+    auto update = [&](int i, int d) { for (++i; i <= n; i += i & -i) bit[i] += d; };
+    auto below = [&](int i) { int r = 0; for (; i > 0; i -= i & -i) r += bit[i]; return r; };
+    for (int k = 0; k < n; ++k) update(k, 1);
+
+    long long total = 0;
+    int worst = 0;
+    for (int i = 0; i < pops; ++i) {
+        int k = q.tryPop()->first;
+        int rank = below(k);  // queued keys smaller than k
+        total += rank;
+        worst = std::max(worst, rank);
+        update(k, -1);
+    }
+    double mean = static_cast<double>(total) / pops;
+    EXPECT_LT(mean, 2.0 * q.queues());
+    EXPECT_LT(worst, 20 * q.queues());
+}
+
+TEST(MultiQueueTest, ConcurrentProducersConsumers) {
+    const int producers = 4, consumers = 4, perProducer = 20000;
+    algo::MultiQueue<int, int> q(producers + consumers);
+    std::atomic<int> producing{producers};
+    std::vector<std::vector<int>> popped(consumers);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < perProducer; ++i) {
+                int v = p * perProducer + i;
+                q.push(v % 997, v);
+            }
+            producing.fetch_sub(1);
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            for (;;) {
+                if (auto e = q.tryPop()) popped[c].push_back(e->second);
+                else if (producing.load() == 0 && q.empty()) break;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    std::vector<int> all;
+    for (auto& v : popped) all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(producers * perProducer));
+    for (int i = 0; i < producers * perProducer; ++i) EXPECT_EQ(all[i], i);
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+    // Pairing heap with O(1) push / meld / decrease-key (amortized sub-log)
+    // and O(log n) amortized pop.
+    //
+    // Nodes live in an index-based Pool instead of individual allocations.
+    // Heaps that share one Pool can be melded in O(1), which makes it easy to
+    // keep one queue per component and meld them alongside DisjointSet::merge:
+    //
+    //     auto pool = std::make_shared<PairingHeap<int>::Pool>();
+    //     std::vector<PairingHeap<int>> q;
+    //     q.reserve(n);
+    //     for (int i = 0; i < n; ++i) q.emplace_back(pool);
+    //     ...
+    //     q[x].meld(q[y]);   // q[y] becomes empty
+    //
+    // push() returns a handle usable with key() / decreaseKey() until that
+    // entry is popped; afterwards the handle may be recycled.
+    //
+    // A heap owns its nodes: it is move-only, and clear() or the destructor
+    // returns the nodes to the Pool.
+    template <typename T, typename Compare = std::less<T>>
+    class PairingHeap {
+    public:
+        using Handle = int;
+
+        class Pool {
+        public:
+            void reserve(std::size_t n) { nodes_.reserve(n); }
+
+            // Nodes currently allocated to some heap.
+            int size() const { return static_cast<int>(nodes_.size() - free_.size()); }
+
+        private:
+            friend class PairingHeap;
+
+            struct Node {
+                T key;
+                int child = -1; // leftmost child
+                int next = -1;  // right sibling
+                int prev = -1;  // left sibling, or parent for a leftmost child
+            };
+
+            std::vector<Node> nodes_;
+            std::vector<int> free_;
+            std::vector<int> scratch_;
+
+            int allocate(T&& key) {
+                if (free_.empty()) {
+                    nodes_.push_back(Node{std::move(key)});
+                    return static_cast<int>(nodes_.size()) - 1;
+                }
+                int id = free_.back();
+                free_.pop_back();
+                nodes_[id] = Node{std::move(key)};
+                return id;
+            }
+        };
+
+        PairingHeap() : pool_(std::make_shared<Pool>()) {}
+
+        explicit PairingHeap(std::shared_ptr<Pool> pool, Compare comp = Compare())
+            : pool_(std::move(pool)), comp_(std::move(comp)) {
+            if (!pool_) throw std::invalid_argument("PairingHeap: null pool.");
+        }
+
+        PairingHeap(const PairingHeap&) = delete;
+        PairingHeap& operator=(const PairingHeap&) = delete;
+
+        PairingHeap(PairingHeap&& other) noexcept
+            : pool_(other.pool_), comp_(std::move(other.comp_)), root_(other.root_), size_(other.size_) {
+            other.root_ = -1;
+            other.size_ = 0;
+        }
+
+        PairingHeap& operator=(PairingHeap&& other) noexcept {
+            if (this != &other) {
+                clear();
+                pool_ = other.pool_;
+                comp_ = std::move(other.comp_);
+                root_ = other.root_;
+                size_ = other.size_;
+                other.root_ = -1;
+                other.size_ = 0;
+            }
+            return *this;
+        }
+
+        ~PairingHeap() {
+            clear();
+        }
+
+        // Return every node to the Pool.
+        void clear() {
+            if (root_ < 0) return;
+            auto& nodes = pool_->nodes_;
+            auto& stack = pool_->scratch_;
+            stack.clear();
+            stack.push_back(root_);
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                if (nodes[u].child >= 0) stack.push_back(nodes[u].child);
+                if (nodes[u].next >= 0) stack.push_back(nodes[u].next);
+                pool_->free_.push_back(u);
+            }
+            root_ = -1;
+            size_ = 0;
+        }
+
+        int size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        const T& top() const {
+            if (root_ < 0) throw std::out_of_range("Topping on empty heap.");
+            return pool_->nodes_[root_].key;
+        }
+
+        const T& key(Handle h) const {
+            return pool_->nodes_[h].key;
+        }
+
+        Handle push(T key) {
+            int id = pool_->allocate(std::move(key));
+            root_ = root_ < 0 ? id : link(root_, id);
+            ++size_;
+            return id;
+        }
+
+        T pop() {
+            if (root_ < 0) throw std::out_of_range("Popping on empty heap.");
+            auto& nodes = pool_->nodes_;
+            int old = root_;
+            T ret = std::move(nodes[old].key);
+            root_ = combineChildren(nodes[old].child);
+            pool_->free_.push_back(old);
+            --size_;
+            return ret;
+        }
+
+        // The new key must not compare after the current one.
+        void decreaseKey(Handle h, T key) {
+            auto& nodes = pool_->nodes_;
+            nodes[h].key = std::move(key);
+            if (h == root_) return;
+
+            int prev = nodes[h].prev, next = nodes[h].next;
+            if (nodes[prev].child == h) nodes[prev].child = next;
+            else nodes[prev].next = next;
+            if (next >= 0) nodes[next].prev = prev;
+            nodes[h].prev = nodes[h].next = -1;
+
+            root_ = link(root_, h);
+        }
+
+        // Move all entries of `other` into this heap in O(1).
+        void meld(PairingHeap& other) {
+            if (this == &other || other.root_ < 0) return;
+            if (pool_ != other.pool_) throw std::invalid_argument("PairingHeap: meld across different pools.");
+            root_ = root_ < 0 ? other.root_ : link(root_, other.root_);
+            size_ += other.size_;
+            other.root_ = -1;
+            other.size_ = 0;
+        }
+
+    private:
+        std::shared_ptr<Pool> pool_;
+        Compare comp_;
+        int root_ = -1;
+        int size_ = 0;
+
+        // Link two roots; the loser becomes the leftmost child of the winner.
+        int link(int a, int b) {
+            auto& nodes = pool_->nodes_;
+            if (comp_(nodes[b].key, nodes[a].key)) std::swap(a, b);
+            nodes[b].prev = a;
+            nodes[b].next = nodes[a].child;
+            if (nodes[a].child >= 0) nodes[nodes[a].child].prev = b;
+            nodes[a].child = b;
+            return a;
+        }
+
+        // Standard two-pass pairing over a sibling list, without recursion.
+        int combineChildren(int first) {
+            if (first < 0) return -1;
+            auto& nodes = pool_->nodes_;
+            auto& pairs = pool_->scratch_;
+            pairs.clear();
+
+            for (int a = first; a >= 0;) {
+                int b = nodes[a].next;
+                int rest = b >= 0 ? nodes[b].next : -1;
+                nodes[a].prev = nodes[a].next = -1;
+                if (b >= 0) {
+                    nodes[b].prev = nodes[b].next = -1;
+                    pairs.push_back(link(a, b));
+                } else {
+                    pairs.push_back(a);
+                }
+                a = rest;
+            }
+
+            int r = pairs.back();
+            for (int i = static_cast<int>(pairs.size()) - 2; i >= 0; --i) {
+                r = link(pairs[i], r);
+            }
+            return r;
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include "pairing_heap.hpp"
+
+#include <memory>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+TEST(PairingHeapTest, Basic) {
+    algo::PairingHeap<int> h;
+    h.push(5);
+    auto three = h.push(3);
+    h.push(8);
+    h.push(1);
+    EXPECT_EQ(h.size(), 4);
+    EXPECT_EQ(h.top(), 1);
+
+    h.decreaseKey(three, 0);
+    EXPECT_EQ(h.top(), 0);
+
+    EXPECT_EQ(h.pop(), 0);
+    EXPECT_EQ(h.pop(), 1);
+    EXPECT_EQ(h.pop(), 5);
+    EXPECT_EQ(h.pop(), 8);
+    EXPECT_TRUE(h.empty());
+    EXPECT_THROW(h.pop(), std::out_of_range);
+}
+
+TEST(PairingHeapTest, MeldSharedPool) {
+    auto pool = std::make_shared<algo::PairingHeap<int>::Pool>();
+    algo::PairingHeap<int> a(pool), b(pool);
+    for (int x : {9, 4, 7}) a.push(x);
+    for (int x : {6, 2, 8}) b.push(x);
+
+    a.meld(b);
+    EXPECT_EQ(a.size(), 6);
+    EXPECT_TRUE(b.empty());
+
+    std::vector<int> out;
+    while (!a.empty()) out.push_back(a.pop());
+    EXPECT_EQ(out, (std::vector<int>{2, 4, 6, 7, 8, 9}));
+    EXPECT_EQ(pool->size(), 0);
+
+    algo::PairingHeap<int> other;
+    other.push(1);
+    a.push(3);
+    EXPECT_THROW(a.meld(other), std::invalid_argument);
+}
+
+TEST(PairingHeapTest, OwnsItsNodes) {
+    static_assert(!std::is_copy_constructible_v<algo::PairingHeap<int>>);
+    static_assert(!std::is_copy_assignable_v<algo::PairingHeap<int>>);
+
+    auto pool = std::make_shared<algo::PairingHeap<int>::Pool>();
+    {
+        std::vector<algo::PairingHeap<int>> q;
+        for (int i = 0; i < 4; ++i) q.emplace_back(pool);
+        for (int i = 0; i < 4; ++i) {
+            for (int x = 0; x < 5; ++x) q[i].push(i * 10 + x);
+        }
+        EXPECT_EQ(pool->size(), 20);
+
+        q[0].meld(q[1]);
+        algo::PairingHeap<int> moved = std::move(q[0]);
+        EXPECT_TRUE(q[0].empty());
+        EXPECT_EQ(moved.size(), 10);
+        EXPECT_EQ(moved.pop(), 0);
+
+        q[2].clear();
+        EXPECT_EQ(pool->size(), 14);
+
+        q[3] = std::move(moved);
+        EXPECT_EQ(pool->size(), 9);
+        EXPECT_EQ(q[3].top(), 1);
+    }
+    EXPECT_EQ(pool->size(), 0);
+}
+
+TEST(PairingHeapTest, RandomWithDecreaseKey) {
+    std::mt19937 rng(99);
+    algo::PairingHeap<std::pair<int, int>> h;
+    std::set<std::pair<int, int>> ref;
+    std::vector<std::pair<int, int>> live;  // (handle, id)
+    std::vector<int> keyOf;
+
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(rng() % 3);
+        if (op == 0 || ref.empty()) {
+            int id = static_cast<int>(keyOf.size());
+            int key = static_cast<int>(rng() % 100000);
+            keyOf.push_back(key);
+            live.push_back({h.push({key, id}), id});
+            ref.insert({key, id});
+        } else if (op == 1) {
+            size_t i = rng() % live.size();
+            auto [handle, id] = live[i];
+            int key = keyOf[id] - static_cast<int>(rng() % 1000);
+            ref.erase({keyOf[id], id});
+            keyOf[id] = key;
+            ref.insert({key, id});
+            h.decreaseKey(handle, {key, id});
+        } else {
+            auto got = h.pop();
+            ASSERT_EQ(got, *ref.begin());
+            ref.erase(ref.begin());
+            for (size_t i = 0; i < live.size(); ++i) {
+                if (live[i].second == got.second) {
+                    live[i] = live.back();
+                    live.pop_back();
+                    break;
+                }
+            }
+        }
+        ASSERT_EQ(h.size(), static_cast<int>(ref.size()));
+    }
+}
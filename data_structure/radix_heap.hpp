@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo {
+
+    // Monotone radix heap for unsigned 32/64-bit keys.
+    //
+    // Keys pushed must be >= the last popped key (as in Dijkstra with
+    // non-negative integer weights). An entry sits in bucket
+    // bit_width(key ^ last), and every pop that empties bucket 0 redistributes
+    // one bucket into strictly lower ones, so each entry moves at most
+    // (key bits) times: O(log C) amortized per operation, no comparisons
+    // between entries.
+    template <typename Key, typename Value>
+    class RadixHeap {
+        static_assert(std::is_unsigned_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                      "RadixHeap keys must be 32- or 64-bit unsigned integers.");
+
+    public:
+        int size() const { return static_cast<int>(size_); }
+        bool empty() const { return size_ == 0; }
+
+        // Last popped key; pushes below it are rejected.
+        Key lastKey() const { return last_; }
+
+        void push(Key key, Value value) {
+            if (key < last_) throw std::invalid_argument("RadixHeap: key below last popped key.");
+            buckets_[bucketOf(key)].emplace_back(key, std::move(value));
+            ++size_;
+        }
+
+        Key topKey() {
+            if (size_ == 0) throw std::out_of_range("Topping on empty heap.");
+            pull();
+            return last_;
+        }
+
+        std::pair<Key, Value> pop() {
+            if (size_ == 0) throw std::out_of_range("Popping on empty heap.");
+            pull();
+            std::pair<Key, Value> ret = std::move(buckets_[0].back());
+            buckets_[0].pop_back();
+            --size_;
+            return ret;
+        }
+
+        void clear() {
+            for (auto& b : buckets_) b.clear();
+            size_ = 0;
+            last_ = 0;
+        }
+
+    private:
+        static constexpr int kBuckets = std::numeric_limits<Key>::digits + 1;
+
+        std::array<std::vector<std::pair<Key, Value>>, kBuckets> buckets_;
+        std::size_t size_ = 0;
+        Key last_ = 0;
+
+        int bucketOf(Key key) const {
+            return static_cast<int>(std::bit_width(static_cast<Key>(key ^ last_)));
+        }
+
+        // Make bucket 0 non-empty; all of its keys equal last_.
+        void pull() {
+            if (!buckets_[0].empty()) return;
+            int i = 1;
+            while (buckets_[i].empty()) ++i;
+
+            Key mn = buckets_[i][0].first;
+            for (const auto& e : buckets_[i]) {
+                if (e.first < mn) mn = e.first;
+            }
+            last_ = mn;
+
+            for (auto& e : buckets_[i]) {
+                buckets_[bucketOf(e.first)].push_back(std::move(e));
+            }
+            buckets_[i].clear();
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include "radix_heap.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST(RadixHeapTest, Basic) {
+    algo::RadixHeap<std::uint32_t, int> h;
+    h.push(5, 0);
+    h.push(1, 1);
+    h.push(9, 2);
+    h.push(1, 3);
+    EXPECT_EQ(h.size(), 4);
+    EXPECT_EQ(h.topKey(), 1u);
+
+    auto a = h.pop();
+    auto b = h.pop();
+    EXPECT_EQ(a.first, 1u);
+    EXPECT_EQ(b.first, 1u);
+    EXPECT_EQ(a.second + b.second, 4);
+
+    // Monotone: pushing below the last popped key is rejected.
+    EXPECT_THROW(h.push(0, 4), std::invalid_argument);
+
+    h.push(6, 5);
+    EXPECT_EQ(h.pop(), std::make_pair(5u, 0));
+    EXPECT_EQ(h.pop(), std::make_pair(6u, 5));
+    EXPECT_EQ(h.pop(), std::make_pair(9u, 2));
+    EXPECT_TRUE(h.empty());
+    EXPECT_THROW(h.pop(), std::out_of_range);
+}
+
+TEST(RadixHeapTest, MonotoneRandomSequence) {
+    std::mt19937_64 rng(7);
+    algo::RadixHeap<std::uint64_t, int> h;
+    std::vector<std::uint64_t> ref;
+    std::uint64_t last = 0;
+
+    for (int step = 0; step < 20000; ++step) {
+        if (ref.empty() || rng() % 3 != 0) {
+            std::uint64_t key = last + rng() % (1ull << (rng() % 40));
+            h.push(key, step);
+            ref.push_back(key);
+            std::push_heap(ref.begin(), ref.end(), std::greater<>());
+        } else {
+            std::pop_heap(ref.begin(), ref.end(), std::greater<>());
+            std::uint64_t expected = ref.back();
+            ref.pop_back();
+            auto got = h.pop();
+            ASSERT_EQ(got.first, expected);
+            last = got.first;
+        }
+    }
+    EXPECT_EQ(h.size(), static_cast<int>(ref.size()));
+}
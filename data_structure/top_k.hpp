@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "heap.hpp"
+
+namespace algo {
+
+    // Streaming top-k accumulator: keeps the K greatest elements seen so far
+    // (greatest under Compare, i.e. std::less keeps the largest values).
+    //
+    // The kept elements form a K-element heap with the current threshold (the
+    // K-th best) on top. Bulk input is scanned in fixed-size blocks: a
+    // branch-free compare of the whole block against the threshold, which the
+    // compiler turns into SIMD compares for arithmetic T, decides whether the
+    // block can contain a candidate at all. Once the threshold has settled
+    // almost every block is rejected by that one pass.
+    //
+    // Partial results from several threads combine with merge(); sorted()
+    // returns the kept elements best first.
+    template <typename T, int K, typename Compare = std::less<T>>
+    class TopK {
+        static_assert(K > 0, "TopK needs K > 0.");
+
+    public:
+        explicit TopK(Compare comp = Compare()) : comp_(comp), heap_(comp) {
+            heap_.reserve(K);
+        }
+
+        int size() const { return heap_.size(); }
+        bool full() const { return heap_.size() == K; }
+
+        // Current K-th best element; only meaningful once full().
+        const T& threshold() const { return heap_.top(); }
+
+        void add(const T& x) {
+            if (heap_.size() < K) heap_.add(x);
+            else if (comp_(heap_.top(), x)) heap_.replaceTop(x);
+        }
+
+        void add(const T* data, std::size_t n) {
+            std::size_t i = 0;
+            while (i < n && heap_.size() < K) add(data[i++]);
+
+            for (; i < n; i += kBlock) {
+                const std::size_t len = std::min(kBlock, n - i);
+                const T* block = data + i;
+                const T limit = heap_.top();
+
+                unsigned hits = 0;
+                for (std::size_t j = 0; j < len; ++j) {
+                    hits |= static_cast<unsigned>(comp_(limit, block[j]));
+                }
+                if (hits == 0) continue;
+
+                for (std::size_t j = 0; j < len; ++j) {
+                    if (comp_(heap_.top(), block[j])) heap_.replaceTop(block[j]);
+                }
+            }
+        }
+
+        void add(const std::vector<T>& values) {
+            add(values.data(), values.size());
+        }
+
+        // Fold in the result of another accumulator (e.g. another thread's).
+        void merge(const TopK& other) {
+            for (const T& x : other.sorted()) add(x);
+        }
+
+        // Kept elements, best first.
+        std::vector<T> sorted() const {
+            Heap<T, Compare> copy = heap_;
+            std::vector<T> out;
+            out.reserve(copy.size());
+            while (!copy.empty()) out.push_back(copy.pop());
+            std::reverse(out.begin(), out.end());
+            return out;
+        }
+
+    private:
+        static constexpr std::size_t kBlock = 64;
+
+        Compare comp_;
+        Heap<T, Compare> heap_;
+    };
+
+} // namespace algo
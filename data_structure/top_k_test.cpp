@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST(TopKTest, KeepsLargest) {
+    algo::TopK<int, 3> top;
+    for (int x : {5, 1, 9, 3, 7, 2}) top.add(x);
+
+    EXPECT_TRUE(top.full());
+    EXPECT_EQ(top.threshold(), 5);
+    EXPECT_EQ(top.sorted(), (std::vector<int>{9, 7, 5}));
+}
+
+TEST(TopKTest, FewerThanK) {
+    algo::TopK<int, 10> top;
+    top.add(std::vector<int>{4, 8});
+    EXPECT_FALSE(top.full());
+    EXPECT_EQ(top.sorted(), (std::vector<int>{8, 4}));
+}
+
+TEST(TopKTest, BlockInputMatchesSort) {
+    std::mt19937 rng(2024);
+    std::vector<long long> data(100000);
+    for (auto& x : data) x = static_cast<long long>(rng() % 1000000);
+
+    algo::TopK<long long, 100> top;
+    top.add(data);
+
+    std::vector<long long> expected = data;
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    expected.resize(100);
+    EXPECT_EQ(top.sorted(), expected);
+}
+
+TEST(TopKTest, SmallestWithGreater) {
+    algo::TopK<double, 2, std::greater<double>> top;
+    std::vector<double> data = {3.5, -1.0, 2.0, 0.5};
+    top.add(data.data(), data.size());
+    EXPECT_EQ(top.sorted(), (std::vector<double>{-1.0, 0.5}));
+}
+
+TEST(TopKTest, MergeThreadPartials) {
+    std::mt19937 rng(7);
+    std::vector<int> data(200000);
+    for (auto& x : data) x = static_cast<int>(rng());
+
+    const int threads = 4;
+    std::vector<algo::TopK<int, 50>> partial(threads);
+    std::vector<std::thread> workers;
+    const size_t chunk = data.size() / threads;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            partial[t].add(data.data() + t * chunk, chunk);
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    algo::TopK<int, 50> total;
+    for (const auto& p : partial) total.merge(p);
+
+    std::vector<int> expected = data;
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    expected.resize(50);
+    EXPECT_EQ(total.sorted(), expected);
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "data_structure/concurrent_disjoint_set.hpp"
+#include "graph/csr_graph.hpp"
+#include "misc/thread_pool.hpp"
+
+namespace algo {
+
+    // Parallel Boruvka minimum spanning forest over a CSR graph.
+    //
+    // Every arc u -> v (u != v) is taken as the undirected edge
+    // {min(u, v), max(u, v)}, so an undirected CSR graph with both arc
+    // copies and a directed one give the same forest. Each round:
+    //
+    //   1. edge-parallel: for every live edge, find both component roots in
+    //      a ConcurrentDisjointSet and offer the edge to both roots; the
+    //      cheapest offer wins by compare-and-swap on the root's slot.
+    //   2. root-parallel: every live root merges along its cheapest edge;
+    //      the edge joins the forest if the merge linked two sets (an edge
+    //      that is cheapest for both its endpoints is merged only once).
+    //   3. edge-parallel: edges inside one component are dropped, and only
+    //      roots that had an offer and are still roots stay live, so later
+    //      rounds never rescan all n vertices.
+    //
+    // Ties are broken by (weight, min(u, v), max(u, v)), a strict order on
+    // distinct edges, so the cheapest edges never close a cycle and the
+    // forest is the same for any number of threads. The number of live
+    // components at least halves per round.
+    //
+    // solve() returns the forest sorted by that order.
+    template <typename W>
+    class ParallelBoruvka {
+    public:
+        using Edge = typename CsrGraph<W>::Edge;
+
+        explicit ParallelBoruvka(const CsrGraph<W>& g) : n_(g.size()) {
+            edges_.reserve(static_cast<std::size_t>(g.edgeCount()));
+            for (int u = 0; u < n_; ++u) {
+                for (auto [v, w] : g[u]) {
+                    if (u != v) edges_.push_back({std::min(u, v), std::max(u, v), w});
+                }
+            }
+        }
+
+        int size() const { return n_; }
+        std::size_t edgeCount() const { return edges_.size(); }
+
+        // Rounds used by the last solve.
+        int rounds() const { return rounds_; }
+
+        std::vector<Edge> solve(ThreadPool& pool) {
+            const int workers = pool.size();
+            ConcurrentDisjointSet dsu(n_);
+            auto best = std::make_unique<std::atomic<long long>[]>(n_);
+            for (int v = 0; v < n_; ++v) best[v].store(-1, std::memory_order_relaxed);
+            std::vector<std::vector<Edge>> chosen(workers), kept(workers);
+            std::vector<std::vector<int>> touched(workers);
+            std::vector<Edge> live = edges_;
+            std::vector<int> roots(n_);
+            std::iota(roots.begin(), roots.end(), 0);
+            rounds_ = 0;
+
+            while (!live.empty()) {
+                ++rounds_;
+                pool.forChunks(live.size(), [&](int, std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        int a = dsu.find(live[i].from), c = dsu.find(live[i].to);
+                        if (a == c) continue;
+                        offer(best[a], live, static_cast<long long>(i));
+                        offer(best[c], live, static_cast<long long>(i));
+                    }
+                });
+                pool.forChunks(roots.size(), [&](int worker, std::size_t b, std::size_t e) {
+                    for (std::size_t r = b; r < e; ++r) {
+                        int v = roots[r];
+                        long long i = best[v].load(std::memory_order_relaxed);
+                        if (i < 0) continue;
+                        best[v].store(-1, std::memory_order_relaxed);
+                        touched[worker].push_back(v);
+                        if (dsu.merge(live[i].from, live[i].to)) chosen[worker].push_back(live[i]);
+                    }
+                });
+                pool.forChunks(live.size(), [&](int worker, std::size_t b, std::size_t e) {
+                    kept[worker].clear();
+                    for (std::size_t i = b; i < e; ++i) {
+                        if (dsu.find(live[i].from) != dsu.find(live[i].to)) kept[worker].push_back(live[i]);
+                    }
+                });
+
+                std::size_t total = 0;
+                for (const auto& k : kept) total += k.size();
+                std::vector<Edge> next;
+                next.reserve(total);
+                for (auto& k : kept) {
+                    next.insert(next.end(), k.begin(), k.end());
+                    k.clear();
+                }
+                live.swap(next);
+
+                // A root without an offer has no live edge left and never
+                // gets one; the root of a merged set had an offer itself.
+                roots.clear();
+                for (auto& t : touched) {
+                    for (int v : t) {
+                        if (dsu.find(v) == v) roots.push_back(v);
+                    }
+                    t.clear();
+                }
+            }
+
+            std::vector<Edge> forest;
+            for (const auto& c : chosen) forest.insert(forest.end(), c.begin(), c.end());
+            std::sort(forest.begin(), forest.end(), less);
+            return forest;
+        }
+
+    private:
+        int n_;
+        std::vector<Edge> edges_;
+        int rounds_ = 0;
+
+        static bool less(const Edge& a, const Edge& b) {
+            if (a.weight != b.weight) return a.weight < b.weight;
+            if (a.from != b.from) return a.from < b.from;
+            return a.to < b.to;
+        }
+
+        static void offer(std::atomic<long long>& slot, const std::vector<Edge>& live, long long i) {
+            long long cur = slot.load(std::memory_order_relaxed);
+            while (cur < 0 || less(live[i], live[cur])) {
+                if (slot.compare_exchange_weak(cur, i, std::memory_order_relaxed)) return;
+            }
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "graph/boruvka.hpp"
+#include "graph/minimum_spanning_tree.hpp"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    using Edge = algo::CsrGraph<int>::Edge;
+
+    vector<Edge> randomEdges(int n, int m, int maxWeight, unsigned seed) {
+        mt19937 rng(seed);
+        vector<Edge> edges;
+        for (int i = 0; i < m; i++) edges.push_back({(int) (rng() % n), (int) (rng() % n), (int) (rng() % maxWeight)});
+        return edges;
+    }
+
+    // Kruskal under the same (weight, min, max) order: the unique forest.
+    vector<Edge> reference(int n, vector<Edge> edges) {
+        for (auto& e : edges) e = {min(e.from, e.to), max(e.from, e.to), e.weight};
+        sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+            return tie(a.weight, a.from, a.to) < tie(b.weight, b.from, b.to);
+        });
+        algo::DisjointSet dsu(n);
+        vector<Edge> forest;
+        for (const auto& e : edges) {
+            if (e.from == e.to || dsu.find(e.from) == dsu.find(e.to)) continue;
+            dsu.merge(e.from, e.to);
+            forest.push_back(e);
+        }
+        return forest;
+    }
+
+    void expectSameForest(const vector<Edge>& a, const vector<Edge>& b) {
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); i++) {
+            EXPECT_EQ(a[i].from, b[i].from);
+            EXPECT_EQ(a[i].to, b[i].to);
+            EXPECT_EQ(a[i].weight, b[i].weight);
+        }
+    }
+}
+
+TEST(ParallelBoruvkaTest, MatchesKruskalForAnyThreadCount) {
+    algo::ThreadPool one(1), two(2), four(4);
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        int n = 200 + seed * 300;
+        // Small weight range: lots of ties.
+        auto edges = randomEdges(n, n * (1 + seed % 5), seed % 2 ? 10 : 1000000, seed);
+        algo::CsrGraph<int> g(n, edges, {.undirected = seed % 3 != 0});
+        algo::ParallelBoruvka<int> boruvka(g);
+        auto expected = reference(n, edges);
+        for (algo::ThreadPool* pool : {&one, &two, &four}) expectSameForest(boruvka.solve(*pool), expected);
+        EXPECT_GT(boruvka.rounds(), 0);
+
+        algo::MinimumSpanningTree<int> kruskal(g);
+        long long a = 0, b = 0;
+        for (const auto& e : kruskal.solve()) a += e.weight;
+        for (const auto& e : expected) b += e.weight;
+        EXPECT_EQ(a, b);
+    }
+}
+
+TEST(ParallelBoruvkaTest, LogarithmicRoundsOnPath) {
+    // A path halves its component count every round.
+    const int n = 1 << 16;
+    vector<Edge> edges;
+    for (int i = 0; i + 1 < n; i++) edges.push_back({i, i + 1, (i * 7919) % 1000});
+    algo::CsrGraph<int> g(n, edges, {.undirected = true});
+    algo::ParallelBoruvka<int> boruvka(g);
+    algo::ThreadPool pool(4);
+    auto forest = boruvka.solve(pool);
+    EXPECT_EQ((int) forest.size(), n - 1);
+    EXPECT_LE(boruvka.rounds(), 17);
+}
+
+TEST(ParallelBoruvkaTest, EmptyAndSelfLoops) {
+    algo::ThreadPool pool(2);
+    algo::CsrGraph<int> empty(0, {});
+    EXPECT_TRUE(algo::ParallelBoruvka<int>(empty).solve(pool).empty());
+    algo::CsrGraph<int> loops(3, {{0, 0, 1}, {1, 1, 2}});
+    algo::ParallelBoruvka<int> boruvka(loops);
+    EXPECT_EQ(boruvka.edgeCount(), 0u);
+    EXPECT_TRUE(boruvka.solve(pool).empty());
+}
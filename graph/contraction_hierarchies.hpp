@@ -0,0 +1,501 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_structure/indexed_heap.hpp"
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Contraction hierarchies (Geisberger et al.) for answering many shortest
+    // path queries on a static directed graph with non-negative integer weights.
+    //
+    // Preprocessing contracts the vertices one at a time. Removing v adds a
+    // shortcut u -> x for every remaining in-neighbour u and out-neighbour x,
+    // unless a witness search (a local Dijkstra from u that avoids v) finds a
+    // path no longer than u -> v -> x. The next vertex is the one with the
+    // smallest edge difference (shortcuts added - arcs removed) plus number
+    // of already contracted neighbours; priorities sit in a heap and are
+    // re-evaluated lazily when popped and eagerly for neighbours of v.
+    //
+    // The rank of a vertex is its position in that order. Every shortest path
+    // then has a version that first climbs and then descends in rank, so both
+    // query directions only search upward:
+    //   upward()   : arc u -> v of the augmented graph with rank v > rank u.
+    //   downward() : arc v -> u for every arc u -> v with rank u > rank v.
+    //
+    // Queries run on a Query object that owns the search workspaces, so any
+    // number of threads can query one hierarchy, each with its own Query.
+    class ContractionHierarchy {
+    public:
+        using Distance = long long;
+        static constexpr Distance kInfinity = std::numeric_limits<Distance>::max();
+
+        struct Options {
+            // A witness search gives up after settling this many vertices. Lower
+            // limits preprocess faster but may keep unnecessary shortcuts.
+            int witnessSettleLimit = 500;
+        };
+
+        class Query;
+
+        ContractionHierarchy() = default;
+
+        template <typename W>
+        explicit ContractionHierarchy(const CsrGraph<W>& g) : ContractionHierarchy(g, Options{}) {}
+
+        template <typename W>
+        ContractionHierarchy(const CsrGraph<W>& g, const Options& options) {
+            static_assert(std::is_integral_v<W>, "ContractionHierarchy needs integer weights.");
+            const int n = g.size();
+            Contractor c(n, std::max(1, options.witnessSettleLimit));
+            for (int u = 0; u < n; ++u) {
+                for (auto [v, w] : g[u]) {
+                    if constexpr (std::is_signed_v<W>) {
+                        if (w < 0) throw std::invalid_argument("ContractionHierarchy: negative edge weight");
+                    }
+                    if (u != v) c.link(u, v, static_cast<Distance>(w));
+                }
+            }
+
+            std::vector<int> contractedNeighbours(n, 0);
+            auto priority = [&](int v) {
+                return static_cast<long long>(c.contract(v, false)) - static_cast<long long>(c.in[v].size()) -
+                       static_cast<long long>(c.out[v].size()) + contractedNeighbours[v];
+            };
+            IndexedHeap<long long> order(n);
+            for (int v = 0; v < n; ++v) order.push(v, priority(v));
+
+            rank_.assign(n, -1);
+            std::vector<CsrGraph<Distance>::Edge> up, down;
+            std::vector<int> neighbours;
+            int next = 0;
+            while (!order.empty()) {
+                int v = order.pop();
+                long long p = priority(v);
+                if (!order.empty() && p > order.topKey()) {
+                    order.push(v, p);
+                    continue;
+                }
+
+                rank_[v] = next++;
+                neighbours.clear();
+                for (const Arc& a : c.out[v]) {
+                    up.push_back({v, a.to, a.weight});
+                    neighbours.push_back(a.to);
+                }
+                for (const Arc& a : c.in[v]) {
+                    down.push_back({v, a.to, a.weight});
+                    neighbours.push_back(a.to);
+                }
+                shortcuts_ += c.contract(v, true);
+                c.remove(v);
+
+                std::sort(neighbours.begin(), neighbours.end());
+                neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+                for (int u : neighbours) {
+                    ++contractedNeighbours[u];
+                    order.update(u, priority(u));
+                }
+            }
+
+            up_ = CsrGraph<Distance>(n, up);
+            down_ = CsrGraph<Distance>(n, down);
+        }
+
+        int size() const { return static_cast<int>(rank_.size()); }
+
+        // Contraction order: 0 was contracted first, size() - 1 last.
+        int rank(int v) const { return rank_[v]; }
+
+        // Shortcuts inserted during preprocessing.
+        long long shortcuts() const { return shortcuts_; }
+
+        const CsrGraph<Distance>& upward() const { return up_; }
+        const CsrGraph<Distance>& downward() const { return down_; }
+
+        // Binary layout, native endianness:
+        //   magic "ALGOCH\0\0", u32 version, u64 n, u64 shortcuts,
+        //   i32 rank[n], then upward() and downward() as
+        //   u64 m, i64 offsets[n + 1], i32 targets[m], i64 weights[m].
+        void save(const std::string& path) const {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("ContractionHierarchy: cannot write " + path);
+
+            std::uint32_t version = kVersion;
+            std::uint64_t n = rank_.size(), shortcuts = shortcuts_;
+            out.write(kMagic, sizeof(kMagic));
+            writeValue(out, version);
+            writeValue(out, n);
+            writeValue(out, shortcuts);
+            writeArray(out, rank_);
+            for (const CsrGraph<Distance>* g : {&up_, &down_}) {
+                std::uint64_t m = g->targets().size();
+                writeValue(out, m);
+                writeArray(out, g->offsets());
+                writeArray(out, g->targets());
+                writeArray(out, g->weights());
+            }
+            if (!out) throw std::runtime_error("ContractionHierarchy: short write to " + path);
+        }
+
+        // Every size is checked against the file length before allocating,
+        // rank must be a permutation and both graphs must be valid CSR arrays,
+        // so a corrupt file throws std::runtime_error instead of failing later.
+        static ContractionHierarchy load(const std::string& path) {
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in) throw std::runtime_error("ContractionHierarchy: cannot open " + path);
+            std::uint64_t left = static_cast<std::uint64_t>(in.tellg());
+            in.seekg(0);
+
+            char magic[sizeof(kMagic)];
+            std::uint32_t version = 0;
+            std::uint64_t n = 0, shortcuts = 0;
+            in.read(magic, sizeof(magic));
+            readValue(in, version);
+            readValue(in, n);
+            readValue(in, shortcuts);
+            left -= std::min<std::uint64_t>(left, sizeof(magic) + sizeof(version) + sizeof(n) + sizeof(shortcuts));
+            if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+                throw std::runtime_error("ContractionHierarchy: bad file " + path);
+            }
+            if (version != kVersion) throw std::runtime_error("ContractionHierarchy: unsupported version in " + path);
+            if (n > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+                throw std::runtime_error("ContractionHierarchy: bad vertex count in " + path);
+            }
+
+            auto truncated = [&] { return std::runtime_error("ContractionHierarchy: truncated file " + path); };
+            ContractionHierarchy ch;
+            ch.shortcuts_ = static_cast<long long>(shortcuts);
+            if (!fits<int>(left, n)) throw truncated();
+            ch.rank_ = readArray<int>(in, n);
+            std::vector<char> used(n, 0);
+            for (int r : ch.rank_) {
+                if (r < 0 || static_cast<std::uint64_t>(r) >= n || used[r]) {
+                    throw std::runtime_error("ContractionHierarchy: rank is not a permutation in " + path);
+                }
+                used[r] = 1;
+            }
+
+            CsrGraph<Distance>* graphs[] = {&ch.up_, &ch.down_};
+            for (CsrGraph<Distance>* g : graphs) {
+                std::uint64_t m = 0;
+                if (!fits<std::uint64_t>(left, 1)) throw truncated();
+                readValue(in, m);
+                if (!fits<long long>(left, n + 1) || !fits<int>(left, m) || !fits<Distance>(left, m)) throw truncated();
+                auto offsets = readArray<long long>(in, n + 1);
+                auto targets = readArray<int>(in, m);
+                auto weights = readArray<Distance>(in, m);
+                if (!in) throw truncated();
+                try {
+                    *g = CsrGraph<Distance>::fromArrays(std::move(offsets), std::move(targets), std::move(weights));
+                } catch (const std::invalid_argument& e) {
+                    throw std::runtime_error("ContractionHierarchy: corrupt graph in " + path + " (" + e.what() + ")");
+                }
+            }
+            return ch;
+        }
+
+    private:
+        static constexpr char kMagic[8] = {'A', 'L', 'G', 'O', 'C', 'H', '\0', '\0'};
+        static constexpr std::uint32_t kVersion = 1;
+
+        struct Arc {
+            int to;
+            Distance weight;
+        };
+
+        // Dynamic adjacency of the remaining graph plus the witness search.
+        class Contractor {
+        public:
+            std::vector<std::vector<Arc>> out, in;
+
+            Contractor(int n, int settleLimit) : out(n), in(n), dist_(n, kInfinity), heap_(n), limit_(settleLimit) {}
+
+            // Add u -> x, or lower its weight if it already exists.
+            void link(int u, int x, Distance w) {
+                setMin(out[u], x, w);
+                setMin(in[x], u, w);
+            }
+
+            // Number of shortcuts needed to contract v; inserted when `apply`.
+            int contract(int v, bool apply) {
+                int count = 0;
+                for (const Arc& a : in[v]) {
+                    Distance bound = -1;
+                    for (const Arc& b : out[v]) {
+                        if (b.to != a.to) bound = std::max(bound, a.weight + b.weight);
+                    }
+                    if (bound < 0) continue;
+                    witnessSearch(a.to, v, bound);
+                    for (const Arc& b : out[v]) {
+                        if (b.to == a.to || dist_[b.to] <= a.weight + b.weight) continue;
+                        ++count;
+                        if (apply) link(a.to, b.to, a.weight + b.weight);
+                    }
+                }
+                return count;
+            }
+
+            void remove(int v) {
+                for (const Arc& a : in[v]) erase(out[a.to], v);
+                for (const Arc& a : out[v]) erase(in[a.to], v);
+                in[v].clear();
+                in[v].shrink_to_fit();
+                out[v].clear();
+                out[v].shrink_to_fit();
+            }
+
+        private:
+            std::vector<Distance> dist_;
+            std::vector<int> touched_;
+            IndexedHeap<Distance> heap_;
+            int limit_;
+
+            static void setMin(std::vector<Arc>& list, int to, Distance w) {
+                for (Arc& a : list) {
+                    if (a.to == to) {
+                        a.weight = std::min(a.weight, w);
+                        return;
+                    }
+                }
+                list.push_back({to, w});
+            }
+
+            static void erase(std::vector<Arc>& list, int to) {
+                for (std::size_t i = 0; i < list.size(); ++i) {
+                    if (list[i].to == to) {
+                        list[i] = list.back();
+                        list.pop_back();
+                        return;
+                    }
+                }
+            }
+
+            // Dijkstra from s avoiding `skip`, up to distance `bound`. Tentative
+            // distances of unsettled vertices are still lengths of real paths.
+            void witnessSearch(int s, int skip, Distance bound) {
+                for (int v : touched_) dist_[v] = kInfinity;
+                touched_.clear();
+                heap_.reset();
+
+                dist_[s] = 0;
+                touched_.push_back(s);
+                heap_.push(s, 0);
+                for (int settled = 0; !heap_.empty() && settled < limit_; ++settled) {
+                    if (heap_.topKey() > bound) break;
+                    int u = heap_.pop();
+                    for (const Arc& a : out[u]) {
+                        if (a.to == skip) continue;
+                        Distance nd = dist_[u] + a.weight;
+                        if (nd >= dist_[a.to]) continue;
+                        if (dist_[a.to] == kInfinity) touched_.push_back(a.to);
+                        dist_[a.to] = nd;
+                        heap_.update(a.to, nd);
+                    }
+                }
+            }
+        };
+
+        std::vector<int> rank_;
+        long long shortcuts_ = 0;
+        CsrGraph<Distance> up_, down_;
+
+        template <typename T>
+        static void writeValue(std::ofstream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename Array>
+        static void writeArray(std::ofstream& out, const Array& a) {
+            out.write(reinterpret_cast<const char*>(a.data()), static_cast<std::streamsize>(a.size() * sizeof(a[0])));
+        }
+
+        template <typename T>
+        static void readValue(std::ifstream& in, T& value) {
+            in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        }
+
+        // Take count values of T out of the `left` unread bytes, if there are enough.
+        template <typename T>
+        static bool fits(std::uint64_t& left, std::uint64_t count) {
+            if (count > left / sizeof(T)) return false;
+            left -= count * sizeof(T);
+            return true;
+        }
+
+        template <typename T>
+        static std::vector<T> readArray(std::ifstream& in, std::uint64_t count) {
+            std::vector<T> a;
+            if (!in) return a;
+            a.resize(count);
+            in.read(reinterpret_cast<char*>(a.data()), static_cast<std::streamsize>(count * sizeof(T)));
+            return a;
+        }
+    };
+
+    // Query workspace over a ContractionHierarchy, which must outlive it.
+    //
+    //   distance(s, t)           : bidirectional upward search, each side
+    //                              stopping once its smallest key reaches the
+    //                              best meeting distance.
+    //   manyToMany(S, T)         : bucket-based table. One backward upward
+    //                              search per target leaves (target, distance)
+    //                              in a bucket at every vertex it settles; one
+    //                              forward search per source then scans the
+    //                              buckets of the vertices it settles.
+    //   oneToMany(s, T)          : manyToMany with a single source.
+    //
+    // All searches use stall-on-demand: a vertex reached more cheaply through
+    // a higher-ranked neighbour is not expanded.
+    class ContractionHierarchy::Query {
+    public:
+        explicit Query(const ContractionHierarchy& ch)
+            : ch_(ch), forward_(ch.size()), backward_(ch.size()), head_(ch.size(), -1) {}
+
+        Distance distance(int s, int t) {
+            check(s);
+            check(t);
+            forward_.reset();
+            backward_.reset();
+            settled_ = 0;
+
+            Distance best = s == t ? 0 : kInfinity;
+            forward_.set(s, 0);
+            forward_.heap.push(s, 0);
+            backward_.set(t, 0);
+            backward_.heap.push(t, 0);
+
+            for (;;) {
+                bool canForward = !forward_.heap.empty() && forward_.heap.topKey() < best;
+                bool canBackward = !backward_.heap.empty() && backward_.heap.topKey() < best;
+                if (!canForward && !canBackward) break;
+                bool goForward = canForward && (!canBackward || forward_.heap.topKey() <= backward_.heap.topKey());
+
+                Side& self = goForward ? forward_ : backward_;
+                Side& other = goForward ? backward_ : forward_;
+                int u = self.heap.pop();
+                ++settled_;
+                if (other.dist[u] != kInfinity) best = std::min(best, self.dist[u] + other.dist[u]);
+                if (!stalled(self, goForward ? ch_.down_ : ch_.up_, u)) relax(self, goForward ? ch_.up_ : ch_.down_, u);
+            }
+            return best;
+        }
+
+        std::vector<Distance> oneToMany(int s, std::span<const int> targets) {
+            return manyToMany(std::span<const int>(&s, 1), targets);
+        }
+
+        // Row-major |sources| x |targets| table; kInfinity where unreachable.
+        std::vector<Distance> manyToMany(std::span<const int> sources, std::span<const int> targets) {
+            for (int s : sources) check(s);
+            for (int t : targets) check(t);
+            settled_ = 0;
+
+            for (int v : bucketed_) head_[v] = -1;
+            bucketed_.clear();
+            bucket_.clear();
+            for (std::size_t j = 0; j < targets.size(); ++j) {
+                search(backward_, ch_.down_, ch_.up_, targets[j], [&](int v, Distance d) {
+                    if (head_[v] == -1) bucketed_.push_back(v);
+                    bucket_.push_back({static_cast<int>(j), head_[v], d});
+                    head_[v] = static_cast<int>(bucket_.size()) - 1;
+                });
+            }
+
+            std::vector<Distance> table(sources.size() * targets.size(), kInfinity);
+            for (std::size_t i = 0; i < sources.size(); ++i) {
+                Distance* row = table.data() + i * targets.size();
+                search(forward_, ch_.up_, ch_.down_, sources[i], [&](int v, Distance d) {
+                    for (int e = head_[v]; e != -1; e = bucket_[e].next) {
+                        row[bucket_[e].target] = std::min(row[bucket_[e].target], d + bucket_[e].dist);
+                    }
+                });
+            }
+            return table;
+        }
+
+        // Vertices settled by the last call, all searches together.
+        long long settled() const { return settled_; }
+
+    private:
+        struct Side {
+            std::vector<Distance> dist;
+            std::vector<int> touched;
+            IndexedHeap<Distance> heap;
+
+            explicit Side(int n) : dist(n, kInfinity), heap(n) {}
+
+            void set(int v, Distance d) {
+                if (dist[v] == kInfinity) touched.push_back(v);
+                dist[v] = d;
+            }
+
+            void reset() {
+                for (int v : touched) dist[v] = kInfinity;
+                touched.clear();
+                heap.reset();
+            }
+        };
+
+        struct BucketEntry {
+            int target;
+            int next;
+            Distance dist;
+        };
+
+        const ContractionHierarchy& ch_;
+        Side forward_, backward_;
+        std::vector<int> head_;
+        std::vector<int> bucketed_;
+        std::vector<BucketEntry> bucket_;
+        long long settled_ = 0;
+
+        void check(int v) const {
+            if (v < 0 || v >= ch_.size()) throw std::out_of_range("ContractionHierarchy: vertex out of range");
+        }
+
+        // Stall-on-demand: `opposite` holds, at u, the arcs between u and its
+        // higher neighbours in the direction this search would enter u from.
+        bool stalled(const Side& side, const CsrGraph<Distance>& opposite, int u) const {
+            for (auto [x, w] : opposite[u]) {
+                if (side.dist[x] != kInfinity && side.dist[x] + w < side.dist[u]) return true;
+            }
+            return false;
+        }
+
+        void relax(Side& side, const CsrGraph<Distance>& graph, int u) {
+            for (auto [v, w] : graph[u]) {
+                Distance nd = side.dist[u] + w;
+                if (nd >= side.dist[v]) continue;
+                side.set(v, nd);
+                side.heap.update(v, nd);
+            }
+        }
+
+        // Exhaustive upward search from s; onSettle(v, d) for every vertex not stalled.
+        template <typename F>
+        void search(Side& side, const CsrGraph<Distance>& graph, const CsrGraph<Distance>& opposite, int s, F&& onSettle) {
+            side.reset();
+            side.set(s, 0);
+            side.heap.push(s, 0);
+            while (!side.heap.empty()) {
+                int u = side.heap.pop();
+                ++settled_;
+                if (stalled(side, opposite, u)) continue;
+                onSettle(u, side.dist[u]);
+                relax(side, graph, u);
+            }
+        }
+    };
+
+} // namespace algo
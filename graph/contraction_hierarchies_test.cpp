@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "graph/contraction_hierarchies.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/dijkstra.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // Grid-like road network with asymmetric random weights plus a few long arcs.
+    algo::CsrGraph<int> roadGraph(int side, unsigned seed) {
+        mt19937 rng(seed);
+        vector<algo::CsrGraph<int>::Edge> edges;
+        auto id = [&](int r, int c) { return r * side + c; };
+        for (int r = 0; r < side; r++) {
+            for (int c = 0; c < side; c++) {
+                if (c + 1 < side) {
+                    edges.push_back({id(r, c), id(r, c + 1), (int) (rng() % 100 + 1)});
+                    edges.push_back({id(r, c + 1), id(r, c), (int) (rng() % 100 + 1)});
+                }
+                if (r + 1 < side) {
+                    edges.push_back({id(r, c), id(r + 1, c), (int) (rng() % 100 + 1)});
+                    edges.push_back({id(r + 1, c), id(r, c), (int) (rng() % 100 + 1)});
+                }
+            }
+        }
+        for (int i = 0; i < side; i++) {
+            edges.push_back({(int) (rng() % (side * side)), (int) (rng() % (side * side)), (int) (rng() % 500)});
+        }
+        return algo::CsrGraph<int>(side * side, edges);
+    }
+
+    string tempPath(const string& name) {
+        return (filesystem::temp_directory_path() / name).string();
+    }
+}
+
+TEST(ContractionHierarchiesTest, QueriesMatchDijkstra) {
+    auto g = roadGraph(25, 7);
+    algo::ContractionHierarchy ch(g);
+    algo::ContractionHierarchy::Query query(ch);
+    algo::Dijkstra dijkstra(g.size());
+
+    vector<int> ranks;
+    for (int v = 0; v < ch.size(); v++) ranks.push_back(ch.rank(v));
+    sort(ranks.begin(), ranks.end());
+    for (int v = 0; v < ch.size(); v++) EXPECT_EQ(ranks[v], v);
+    EXPECT_GT(ch.shortcuts(), 0);
+    EXPECT_LE(ch.upward().edgeCount() + ch.downward().edgeCount(), g.edgeCount() + ch.shortcuts());
+
+    mt19937 rng(3);
+    for (int q = 0; q < 40; q++) {
+        int s = rng() % g.size();
+        dijkstra.run(g, s);
+        for (int k = 0; k < 10; k++) {
+            int t = rng() % g.size();
+            EXPECT_EQ(query.distance(s, t), dijkstra.distance(t)) << s << " -> " << t;
+        }
+    }
+    EXPECT_EQ(query.distance(5, 5), 0);
+}
+
+TEST(ContractionHierarchiesTest, DirectedUnreachableAndParallelArcs) {
+    // 0 -> 1 -> 2 -> 3 with a cheaper parallel 1 -> 2 and a one-way shortcut 0 -> 3.
+    vector<algo::CsrGraph<int>::Edge> edges = {
+        {0, 1, 2}, {1, 2, 9}, {1, 2, 3}, {2, 3, 4}, {0, 3, 20}, {4, 0, 1}, {2, 2, 1},
+    };
+    algo::CsrGraph<int> g(6, edges);
+    algo::ContractionHierarchy ch(g);
+    algo::ContractionHierarchy::Query query(ch);
+
+    EXPECT_EQ(query.distance(0, 3), 9);
+    EXPECT_EQ(query.distance(4, 3), 10);
+    EXPECT_EQ(query.distance(3, 0), algo::ContractionHierarchy::kInfinity);
+    EXPECT_EQ(query.distance(0, 5), algo::ContractionHierarchy::kInfinity);
+    EXPECT_THROW(query.distance(0, 6), std::out_of_range);
+}
+
+TEST(ContractionHierarchiesTest, DistanceTablesMatchDijkstra) {
+    auto g = roadGraph(20, 11);
+    algo::ContractionHierarchy::Options options;
+    options.witnessSettleLimit = 20;
+    algo::ContractionHierarchy ch(g, options);
+    algo::ContractionHierarchy::Query query(ch);
+    algo::Dijkstra dijkstra(g.size());
+
+    mt19937 rng(5);
+    vector<int> sources, targets;
+    for (int i = 0; i < 7; i++) sources.push_back(rng() % g.size());
+    for (int i = 0; i < 12; i++) targets.push_back(rng() % g.size());
+    targets.push_back(targets[0]);
+
+    auto table = query.manyToMany(sources, targets);
+    ASSERT_EQ(table.size(), sources.size() * targets.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        dijkstra.run(g, sources[i]);
+        for (size_t j = 0; j < targets.size(); j++) {
+            EXPECT_EQ(table[i * targets.size() + j], dijkstra.distance(targets[j]));
+        }
+    }
+
+    auto row = query.oneToMany(sources[2], targets);
+    dijkstra.run(g, sources[2]);
+    for (size_t j = 0; j < targets.size(); j++) EXPECT_EQ(row[j], dijkstra.distance(targets[j]));
+}
+
+TEST(ContractionHierarchiesTest, SaveAndLoad) {
+    auto g = roadGraph(15, 2);
+    algo::ContractionHierarchy ch(g);
+    const string path = tempPath("algo_contraction_hierarchy.bin");
+    ch.save(path);
+
+    auto loaded = algo::ContractionHierarchy::load(path);
+    EXPECT_EQ(loaded.size(), ch.size());
+    EXPECT_EQ(loaded.shortcuts(), ch.shortcuts());
+    EXPECT_TRUE(ranges::equal(loaded.upward().targets(), ch.upward().targets()));
+    EXPECT_TRUE(ranges::equal(loaded.downward().weights(), ch.downward().weights()));
+
+    algo::ContractionHierarchy::Query a(ch), b(loaded);
+    for (int s = 0; s < g.size(); s += 17) {
+        for (int t = 0; t < g.size(); t += 13) EXPECT_EQ(a.distance(s, t), b.distance(s, t));
+    }
+
+    filesystem::resize_file(path, 40);
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+    filesystem::remove(path);
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+}
+
+TEST(ContractionHierarchiesTest, LoadRejectsCorruptFiles) {
+    auto g = roadGraph(6, 3);
+    algo::ContractionHierarchy ch(g);
+    const string path = tempPath("algo_contraction_hierarchy_corrupt.bin");
+    const long long n = ch.size();
+    const long long rankAt = 28, upAt = rankAt + 4 * n;
+    const long long offsetsAt = upAt + 8, targetsAt = offsetsAt + 8 * (n + 1);
+
+    // Save a fresh copy and overwrite `value` at byte `at`.
+    auto corrupt = [&](long long at, auto value) {
+        ch.save(path);
+        fstream f(path, ios::binary | ios::in | ios::out);
+        f.seekp(at);
+        f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    corrupt(rankAt, ch.rank(1));
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+    corrupt(upAt, static_cast<uint64_t>(1) << 60);
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+    corrupt(offsetsAt + 8, static_cast<long long>(ch.upward().edgeCount() + 1));
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+    corrupt(targetsAt, static_cast<int>(n + 5));
+    EXPECT_THROW(algo::ContractionHierarchy::load(path), std::runtime_error);
+
+    ch.save(path);
+    EXPECT_EQ(algo::ContractionHierarchy::load(path).size(), n);
+    filesystem::remove(path);
+}
+
+TEST(ContractionHierarchiesTest, RejectsNegativeWeights) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 1}, {1, 2, -1}};
+    algo::CsrGraph<int> g(3, edges);
+    EXPECT_THROW(algo::ContractionHierarchy ch(g), std::invalid_argument);
+}
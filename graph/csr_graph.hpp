@@ -0,0 +1,345 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "misc/thread_pool.hpp"
+
+namespace algo {
+
+    // Compressed sparse row graph: all arcs in three flat arrays.
+    //
+    //   offsets[u] .. offsets[u + 1] : arc indices leaving u
+    //   targets[e], weights[e]       : head and weight of arc e
+    //   reverse[e]                   : paired arc (optional, for flow)
+    //
+    // Compared with vector<vector<pair<int, W>>> there is no per-vertex
+    // allocation, and scanning the arcs of u is a sequential read.
+    //
+    // Construction from an edge list is a counting sort in O(n + m); arcs of a
+    // vertex keep the input order. With a ThreadPool the count and scatter
+    // passes run in parallel and produce exactly the same arrays.
+    //
+    // Iterating G[u] yields (target, weight) pairs, so algorithms written
+    // against adjacency lists (`for (auto [v, w] : G[u])`) accept it as is.
+    //
+    // The arrays are immutable once built and shared between copies. They
+    // can also live outside the graph: fromView() wraps arrays in a mapped
+    // file without copying them.
+    template <typename W = int>
+    class CsrGraph {
+    public:
+        using Weight = W;
+
+        struct Edge {
+            int from, to;
+            W weight;
+        };
+
+        struct BuildOptions {
+            // Also insert to -> from with the same weight.
+            bool undirected = false;
+            // Pair every arc with a reverse arc and record reverse[e]. For a
+            // directed graph the reverse arc has weight W{} (residual capacity
+            // of a flow network); for an undirected one the two directions are
+            // paired with each other.
+            bool reverseEdges = false;
+            // Parallel build when non-null.
+            ThreadPool* pool = nullptr;
+        };
+
+        class EdgeRange {
+        public:
+            class iterator {
+            public:
+                iterator(const int* t, const W* w) : t_(t), w_(w) {}
+                std::pair<int, W> operator*() const { return {*t_, *w_}; }
+                iterator& operator++() { ++t_; ++w_; return *this; }
+                bool operator!=(const iterator& o) const { return t_ != o.t_; }
+                bool operator==(const iterator& o) const { return t_ == o.t_; }
+            private:
+                const int* t_;
+                const W* w_;
+            };
+
+            EdgeRange(const int* t, const W* w, std::size_t n) : t_(t), w_(w), n_(n) {}
+            iterator begin() const { return {t_, w_}; }
+            iterator end() const { return {t_ + n_, w_ + n_}; }
+            std::size_t size() const { return n_; }
+
+        private:
+            const int* t_;
+            const W* w_;
+            std::size_t n_;
+        };
+
+        CsrGraph() = default;
+
+        CsrGraph(int n, const std::vector<Edge>& edges) : CsrGraph(n, edges, BuildOptions{}) {}
+
+        CsrGraph(int n, const std::vector<Edge>& edges, const BuildOptions& options)
+            : n_(n), hasReverse_(options.reverseEdges) {
+            if (n < 0) throw std::invalid_argument("CsrGraph: negative vertex count");
+            for (const Edge& e : edges) {
+                if (e.from < 0 || e.from >= n || e.to < 0 || e.to >= n) {
+                    throw std::out_of_range("CsrGraph: edge (" + std::to_string(e.from) + ", " +
+                                            std::to_string(e.to) + ") out of range");
+                }
+            }
+            const bool twoArcs = options.undirected || options.reverseEdges;
+            Arrays a;
+            if (options.pool != nullptr && options.pool->size() > 1) {
+                buildParallel(a, edges, options, twoArcs);
+            } else {
+                buildSequential(a, edges, options, twoArcs);
+            }
+            adopt(std::move(a));
+        }
+
+        // Adopt ready-made CSR arrays (e.g. read back from disk) without re-sorting.
+        // `reverse` may be empty; otherwise it must pair arcs as described above.
+        // Sizes, offset order, target range and reverse pairing are all checked
+        // in O(n + m); std::invalid_argument on any violation.
+        static CsrGraph fromArrays(std::vector<long long> offsets, std::vector<int> targets,
+                                   std::vector<W> weights, std::vector<long long> reverse = {}) {
+            checkArrays(offsets, targets, weights, reverse);
+            checkContents(offsets, targets, reverse);
+            CsrGraph g;
+            g.n_ = static_cast<int>(offsets.size()) - 1;
+            g.hasReverse_ = !reverse.empty();
+            g.adopt({std::move(offsets), std::move(targets), std::move(weights), std::move(reverse)});
+            return g;
+        }
+
+        // View CSR arrays that live elsewhere (e.g. a mapped graph file, see
+        // graph_file.hpp) without copying them. `owner` keeps that memory
+        // alive as long as any copy of the graph does. Only the array sizes
+        // are checked here.
+        static CsrGraph fromView(std::shared_ptr<const void> owner, std::span<const long long> offsets,
+                                 std::span<const int> targets, std::span<const W> weights,
+                                 std::span<const long long> reverse = {}) {
+            checkArrays(offsets, targets, weights, reverse);
+            CsrGraph g;
+            g.n_ = static_cast<int>(offsets.size()) - 1;
+            g.hasReverse_ = !reverse.empty();
+            g.storage_ = std::move(owner);
+            g.offsets_ = offsets;
+            g.targets_ = targets;
+            g.weights_ = weights;
+            g.reverse_ = reverse;
+            return g;
+        }
+
+        int size() const { return n_; }
+        long long edgeCount() const { return static_cast<long long>(targets_.size()); }
+        bool hasReverse() const { return hasReverse_; }
+
+        EdgeRange operator[](int u) const {
+            long long b = offsets_[u], e = offsets_[u + 1];
+            return EdgeRange(targets_.data() + b, weights_.data() + b, static_cast<std::size_t>(e - b));
+        }
+
+        std::span<const int> neighbors(int u) const {
+            return targets_.subspan(offsets_[u], static_cast<std::size_t>(offsets_[u + 1] - offsets_[u]));
+        }
+
+        std::span<const W> weightsOf(int u) const {
+            return weights_.subspan(offsets_[u], static_cast<std::size_t>(offsets_[u + 1] - offsets_[u]));
+        }
+
+        int degree(int u) const { return static_cast<int>(offsets_[u + 1] - offsets_[u]); }
+
+        // Arc-index interface, e.g. for flow algorithms that update per arc.
+        long long begin(int u) const { return offsets_[u]; }
+        long long end(int u) const { return offsets_[u + 1]; }
+        int target(long long e) const { return targets_[e]; }
+        const W& weight(long long e) const { return weights_[e]; }
+        long long reverse(long long e) const { return reverse_[e]; }
+
+        // Graph with every arc reversed (reverse pairing is not carried over).
+        CsrGraph transposed() const {
+            Arrays a;
+            a.offsets.assign(n_ + 1, 0);
+            for (int v : targets_) ++a.offsets[v + 1];
+            for (int u = 0; u < n_; ++u) a.offsets[u + 1] += a.offsets[u];
+            a.targets.resize(a.offsets[n_]);
+            a.weights.resize(a.offsets[n_]);
+
+            std::vector<long long> cursor(a.offsets.begin(), a.offsets.end() - 1);
+            for (int u = 0; u < n_; ++u) {
+                for (long long e = offsets_[u]; e < offsets_[u + 1]; ++e) {
+                    long long pos = cursor[targets_[e]]++;
+                    a.targets[pos] = u;
+                    a.weights[pos] = weights_[e];
+                }
+            }
+            CsrGraph t;
+            t.n_ = n_;
+            t.adopt(std::move(a));
+            return t;
+        }
+
+        std::span<const long long> offsets() const { return offsets_; }
+        std::span<const int> targets() const { return targets_; }
+        std::span<const W> weights() const { return weights_; }
+        std::span<const long long> reverseIndex() const { return reverse_; }
+
+    private:
+        // Arrays of a graph built in memory. Copies of a graph share them;
+        // nothing modifies them after construction.
+        struct Arrays {
+            std::vector<long long> offsets;
+            std::vector<int> targets;
+            std::vector<W> weights;
+            std::vector<long long> reverse;
+        };
+
+        static constexpr long long kNoArcs[1] = {0};
+
+        int n_ = 0;
+        bool hasReverse_ = false;
+        // Owner of the memory the views below point into: an Arrays, or
+        // whatever fromView() was handed.
+        std::shared_ptr<const void> storage_;
+        std::span<const long long> offsets_ = kNoArcs;
+        std::span<const int> targets_;
+        std::span<const W> weights_;
+        std::span<const long long> reverse_;
+
+        static void checkArrays(std::span<const long long> offsets, std::span<const int> targets,
+                                std::span<const W> weights, std::span<const long long> reverse) {
+            if (offsets.empty() || offsets.front() != 0 ||
+                offsets.back() != static_cast<long long>(targets.size()) ||
+                targets.size() != weights.size() || (!reverse.empty() && reverse.size() != targets.size()) ||
+                offsets.size() - 1 > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+                throw std::invalid_argument("CsrGraph: inconsistent CSR arrays");
+            }
+        }
+
+        static void checkContents(std::span<const long long> offsets, std::span<const int> targets,
+                                  std::span<const long long> reverse) {
+            const long long n = static_cast<long long>(offsets.size()) - 1;
+            const long long m = static_cast<long long>(targets.size());
+            for (long long u = 0; u < n; ++u) {
+                if (offsets[u] > offsets[u + 1]) throw std::invalid_argument("CsrGraph: offsets not monotone");
+            }
+            for (int v : targets) {
+                if (v < 0 || v >= n) throw std::invalid_argument("CsrGraph: arc target out of range");
+            }
+            for (long long e = 0; e < static_cast<long long>(reverse.size()); ++e) {
+                long long r = reverse[e];
+                if (r < 0 || r >= m || reverse[r] != e) throw std::invalid_argument("CsrGraph: bad reverse index");
+            }
+        }
+
+        void adopt(Arrays&& a) {
+            auto owned = std::make_shared<const Arrays>(std::move(a));
+            offsets_ = owned->offsets;
+            targets_ = owned->targets;
+            weights_ = owned->weights;
+            reverse_ = owned->reverse;
+            storage_ = std::move(owned);
+        }
+
+        void allocateArcs(Arrays& a, long long m) const {
+            a.targets.resize(m);
+            a.weights.resize(m);
+            if (hasReverse_) a.reverse.resize(m);
+        }
+
+        // Place input edge e using per-vertex cursors.
+        void scatter(Arrays& a, const Edge& e, const BuildOptions& options, std::vector<long long>& cursor) const {
+            long long fwd = cursor[e.from]++;
+            a.targets[fwd] = e.to;
+            a.weights[fwd] = e.weight;
+            if (!options.undirected && !options.reverseEdges) return;
+
+            long long back = cursor[e.to]++;
+            a.targets[back] = e.from;
+            a.weights[back] = options.undirected ? e.weight : W{};
+            if (hasReverse_) {
+                a.reverse[fwd] = back;
+                a.reverse[back] = fwd;
+            }
+        }
+
+        void buildSequential(Arrays& a, const std::vector<Edge>& edges, const BuildOptions& options,
+                             bool twoArcs) const {
+            a.offsets.assign(n_ + 1, 0);
+            for (const Edge& e : edges) {
+                ++a.offsets[e.from + 1];
+                if (twoArcs) ++a.offsets[e.to + 1];
+            }
+            for (int u = 0; u < n_; ++u) a.offsets[u + 1] += a.offsets[u];
+            allocateArcs(a, a.offsets[n_]);
+
+            std::vector<long long> cursor(a.offsets.begin(), a.offsets.end() - 1);
+            for (const Edge& e : edges) scatter(a, e, options, cursor);
+        }
+
+        // Every worker counts the arcs of its chunk of the edge list, then
+        // cursors are laid out vertex by vertex in worker order, which is the
+        // order the sequential build would produce. Scratch is O(n * workers).
+        void buildParallel(Arrays& a, const std::vector<Edge>& edges, const BuildOptions& options,
+                           bool twoArcs) const {
+            ThreadPool& pool = *options.pool;
+            const int workers = pool.size();
+            std::vector<std::vector<long long>> cursor(workers);
+
+            pool.forChunks(edges.size(), [&](int t, std::size_t b, std::size_t e) {
+                cursor[t].assign(n_, 0);
+                for (std::size_t i = b; i < e; ++i) {
+                    ++cursor[t][edges[i].from];
+                    if (twoArcs) ++cursor[t][edges[i].to];
+                }
+            });
+            for (auto& c : cursor) {
+                if (c.empty()) c.assign(n_, 0);
+            }
+
+            a.offsets.assign(n_ + 1, 0);
+            pool.forChunks(n_, [&](int, std::size_t b, std::size_t e) {
+                for (std::size_t u = b; u < e; ++u) {
+                    long long total = 0;
+                    for (int t = 0; t < workers; ++t) total += cursor[t][u];
+                    a.offsets[u + 1] = total;
+                }
+            });
+            for (int u = 0; u < n_; ++u) a.offsets[u + 1] += a.offsets[u];
+            allocateArcs(a, a.offsets[n_]);
+
+            pool.forChunks(n_, [&](int, std::size_t b, std::size_t e) {
+                for (std::size_t u = b; u < e; ++u) {
+                    long long pos = a.offsets[u];
+                    for (int t = 0; t < workers; ++t) {
+                        long long cnt = cursor[t][u];
+                        cursor[t][u] = pos;
+                        pos += cnt;
+                    }
+                }
+            });
+
+            pool.forChunks(edges.size(), [&](int t, std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) scatter(a, edges[i], options, cursor[t]);
+            });
+        }
+    };
+
+    // Uniform neighbour access for trees and unweighted traversals, so the
+    // same code accepts adjacency lists and CSR graphs.
+    inline const std::vector<int>& neighbors(const std::vector<std::vector<int>>& g, int u) {
+        return g[u];
+    }
+
+    template <typename W>
+    std::span<const int> neighbors(const CsrGraph<W>& g, int u) {
+        return g.neighbors(u);
+    }
+
+} // namespace algo
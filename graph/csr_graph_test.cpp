@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "graph/csr_graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/lca.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using Graph = algo::CsrGraph<int>;
+
+TEST(CsrGraphTest, DirectedBuildKeepsInputOrder) {
+    vector<Graph::Edge> edges = {{0, 2, 5}, {1, 0, 3}, {0, 1, 7}, {2, 1, 1}};
+    Graph g(3, edges);
+
+    EXPECT_EQ(g.size(), 3);
+    EXPECT_EQ(g.edgeCount(), 4);
+    EXPECT_EQ(g.degree(0), 2);
+
+    vector<pair<int, int>> out0;
+    for (auto [v, w] : g[0]) out0.push_back({v, w});
+    EXPECT_EQ(out0, (vector<pair<int, int>>{{2, 5}, {1, 7}}));
+    EXPECT_EQ(vector<int>(g.neighbors(1).begin(), g.neighbors(1).end()), vector<int>{0});
+    EXPECT_FALSE(g.hasReverse());
+
+    EXPECT_THROW(Graph(2, edges), std::out_of_range);
+}
+
+TEST(CsrGraphTest, ReverseEdgesArePaired) {
+    vector<Graph::Edge> edges = {{0, 1, 4}, {1, 2, 6}, {0, 2, 1}};
+    Graph::BuildOptions options;
+    options.reverseEdges = true;
+    Graph g(3, edges, options);
+
+    EXPECT_EQ(g.edgeCount(), 6);
+    for (int u = 0; u < g.size(); u++) {
+        for (long long e = g.begin(u); e < g.end(u); e++) {
+            long long r = g.reverse(e);
+            EXPECT_EQ(g.reverse(r), e);
+            EXPECT_EQ(g.target(r), u);
+            // Exactly one of the pair carries the capacity.
+            EXPECT_TRUE(g.weight(e) == 0 || g.weight(r) == 0);
+        }
+    }
+}
+
+TEST(CsrGraphTest, ParallelBuildMatchesSequential) {
+    mt19937 rng(3);
+    const int n = 500;
+    vector<Graph::Edge> edges(20000);
+    for (auto& e : edges) e = {(int) (rng() % n), (int) (rng() % n), (int) (rng() % 100)};
+
+    Graph::BuildOptions options;
+    options.undirected = true;
+    options.reverseEdges = true;
+    Graph seq(n, edges, options);
+
+    algo::ThreadPool pool(4);
+    options.pool = &pool;
+    Graph par(n, edges, options);
+
+    EXPECT_TRUE(ranges::equal(seq.offsets(), par.offsets()));
+    EXPECT_TRUE(ranges::equal(seq.targets(), par.targets()));
+    EXPECT_TRUE(ranges::equal(seq.weights(), par.weights()));
+    EXPECT_TRUE(ranges::equal(seq.reverseIndex(), par.reverseIndex()));
+}
+
+TEST(CsrGraphTest, DijkstraOnCsrMatchesAdjacencyList) {
+    mt19937 rng(11);
+    const int n = 300;
+    vector<Graph::Edge> edges;
+    vector<vector<pair<int, int>>> adj(n);
+    for (int i = 0; i < 3000; i++) {
+        int u = rng() % n, v = rng() % n, w = rng() % 1000;
+        edges.push_back({u, v, w});
+        adj[u].push_back({v, w});
+    }
+    Graph g(n, edges);
+
+    algo::Dijkstra a, b;
+    for (int s = 0; s < n; s += 37) {
+        a.run(adj, s);
+        b.run(g, s);
+        for (int v = 0; v < n; v++) ASSERT_EQ(a.distance(v), b.distance(v));
+    }
+}
+
+TEST(CsrGraphTest, LcaOnCsrTree) {
+    // 0 -> {1, 2}, 1 -> {3, 4}
+    vector<Graph::Edge> edges = {{0, 1, 1}, {0, 2, 1}, {1, 3, 1}, {1, 4, 1}};
+    Graph::BuildOptions options;
+    options.undirected = true;
+    Graph tree(5, edges, options);
+
+    algo::Lca lca(tree, 0);
+    EXPECT_EQ(lca.lca(3, 4), 1);
+    EXPECT_EQ(lca.lca(3, 2), 0);
+    EXPECT_EQ(lca.dist(4, 2), 3);
+}
+
+TEST(CsrGraphTest, Transposed) {
+    vector<Graph::Edge> edges = {{0, 1, 4}, {2, 1, 6}, {1, 0, 1}};
+    Graph t = Graph(3, edges).transposed();
+
+    EXPECT_EQ(t.edgeCount(), 3);
+    vector<pair<int, int>> in1;
+    for (auto [v, w] : t[1]) in1.push_back({v, w});
+    EXPECT_EQ(in1, (vector<pair<int, int>>{{0, 4}, {2, 6}}));
+    EXPECT_EQ(t.degree(2), 0);
+}
+
+TEST(CsrGraphTest, FromArraysValidatesContents) {
+    auto g = algo::CsrGraph<int>::fromArrays({0, 1, 2}, {1, 0}, {5, 7}, {1, 0});
+    EXPECT_EQ(g.size(), 2);
+    EXPECT_EQ(g.reverse(0), 1);
+
+    EXPECT_THROW(algo::CsrGraph<int>::fromArrays({0, 2, 1, 2}, {1, 0}, {5, 7}), std::invalid_argument);
+    EXPECT_THROW(algo::CsrGraph<int>::fromArrays({0, 1, 2}, {1, 2}, {5, 7}), std::invalid_argument);
+    EXPECT_THROW(algo::CsrGraph<int>::fromArrays({0, 1, 2}, {1, -1}, {5, 7}), std::invalid_argument);
+    EXPECT_THROW(algo::CsrGraph<int>::fromArrays({0, 1, 2}, {1, 0}, {5, 7}, {0, 0}), std::invalid_argument);
+    EXPECT_THROW(algo::CsrGraph<int>::fromArrays({0, 1, 3}, {1, 0}, {5, 7}), std::invalid_argument);
+}
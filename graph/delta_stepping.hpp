@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+#include "misc/thread_pool.hpp"
+
+namespace algo {
+
+    // Parallel single-source shortest paths by delta-stepping
+    // (Meyer & Sanders) for non-negative integer weights.
+    //
+    // Tentative distances are grouped into buckets of width delta. The lowest
+    // non-empty bucket is settled in phases: all light edges (w <= delta) of
+    // its vertices are relaxed in parallel, repeating while the bucket refills;
+    // then the heavy edges of every vertex removed from it are relaxed once.
+    // Relaxations use an atomic fetch-min, so the resulting distances are the
+    // exact shortest distances, identical to Dijkstra.
+    //
+    // delta = 1 degenerates to Dijkstra-like bucket order, delta = infinity to
+    // a parallel Bellman-Ford; autoDelta() picks max weight / average degree,
+    // the Theta(1 / d) choice from the original analysis.
+    class DeltaStepping {
+    public:
+        using Distance = long long;
+        static constexpr Distance kInfinity = std::numeric_limits<Distance>::max();
+        // Upper bound on the cyclic bucket window (max weight / delta + 2).
+        static constexpr long long kMaxBuckets = 1 << 20;
+
+        // Runs on `pool` when given, otherwise single-threaded.
+        explicit DeltaStepping(ThreadPool* pool = nullptr) : pool_(pool) {
+            if (pool_ == nullptr) {
+                own_ = std::make_unique<ThreadPool>(1);
+                pool_ = own_.get();
+            }
+        }
+
+        template <typename W>
+        static Distance autoDelta(const CsrGraph<W>& g) {
+            static_assert(std::is_integral_v<W>, "DeltaStepping needs integer weights.");
+            if (g.edgeCount() == 0) return 1;
+            W maxW = 0;
+            for (const W& w : g.weights()) maxW = std::max(maxW, w);
+            long long avgDegree = std::max<long long>(1, (g.edgeCount() + g.size() - 1) / std::max(1, g.size()));
+            return std::max<Distance>(1, static_cast<Distance>(maxW) / avgDegree);
+        }
+
+        // delta <= 0 selects autoDelta(g). A delta below
+        // ceil(max weight / kMaxBuckets) is raised to that value, so the bucket
+        // window stays bounded; delta() reports the value used. Any delta gives
+        // exact distances.
+        template <typename W>
+        void run(const CsrGraph<W>& g, int s, Distance delta = 0) {
+            static_assert(std::is_integral_v<W>, "DeltaStepping needs integer weights.");
+            const int n = g.size();
+            if (s < 0 || s >= n) throw std::out_of_range("DeltaStepping: source out of range");
+            if (delta <= 0) delta = autoDelta(g);
+
+            W maxW = 0;
+            for (const W& w : g.weights()) {
+                if constexpr (std::is_signed_v<W>) {
+                    if (w < 0) throw std::invalid_argument("DeltaStepping: negative edge weight");
+                }
+                maxW = std::max(maxW, w);
+            }
+            delta = std::max<Distance>(delta, (static_cast<Distance>(maxW) + kMaxBuckets - 1) / kMaxBuckets);
+
+            delta_ = delta;
+            phases_ = 0;
+            relaxations_ = 0;
+            dist_ = std::vector<std::atomic<Distance>>(n);
+            for (auto& d : dist_) d.store(kInfinity, std::memory_order_relaxed);
+            seen_.assign(n, -1);
+            removed_.assign(n, -1);
+            improved_.assign(pool_->size(), {});
+
+            // Tentative distances lie within [i * delta, i * delta + maxW], so a
+            // cyclic window of buckets is enough.
+            const long long window = static_cast<long long>(maxW) / delta + 2;
+            buckets_.assign(window, {});
+
+            dist_[s].store(0, std::memory_order_relaxed);
+            buckets_[0].push_back(s);
+
+            std::vector<int> frontier, settled;
+            long long emptyRun = 0;
+            for (long long i = 0; emptyRun < window; ++i) {
+                auto& bucket = buckets_[i % window];
+                if (bucket.empty()) {
+                    ++emptyRun;
+                    continue;
+                }
+                emptyRun = 0;
+                settled.clear();
+
+                while (!bucket.empty()) {
+                    frontier.clear();
+                    for (int v : bucket) {
+                        if (seen_[v] == phases_ || dist_[v].load(std::memory_order_relaxed) / delta != i) continue;
+                        seen_[v] = phases_;
+                        frontier.push_back(v);
+                        if (removed_[v] != i) {
+                            removed_[v] = i;
+                            settled.push_back(v);
+                        }
+                    }
+                    bucket.clear();
+                    ++phases_;
+                    relaxAll(g, frontier, true);
+                    distribute(window);
+                }
+
+                relaxAll(g, settled, false);
+                distribute(window);
+            }
+        }
+
+        Distance distance(int v) const { return dist_[v].load(std::memory_order_relaxed); }
+
+        std::vector<Distance> distances() const {
+            std::vector<Distance> ret(dist_.size());
+            for (std::size_t v = 0; v < dist_.size(); ++v) ret[v] = dist_[v].load(std::memory_order_relaxed);
+            return ret;
+        }
+
+        Distance delta() const { return delta_; }
+        long long phases() const { return phases_; }
+        long long relaxations() const { return relaxations_; }
+
+    private:
+        static constexpr std::size_t kParallelThreshold = 256;
+
+        ThreadPool* pool_;
+        std::unique_ptr<ThreadPool> own_;
+        Distance delta_ = 1;
+        long long phases_ = 0;
+        long long relaxations_ = 0;
+
+        std::vector<std::atomic<Distance>> dist_;
+        std::vector<std::vector<int>> buckets_;
+        std::vector<std::vector<int>> improved_; // per worker
+        std::vector<long long> seen_;    // last light phase that scanned v
+        std::vector<long long> removed_; // last bucket v was removed from
+
+        // Relax light (w <= delta) or heavy edges of every vertex in `list`.
+        template <typename W>
+        void relaxAll(const CsrGraph<W>& g, const std::vector<int>& list, bool light) {
+            std::atomic<long long> relaxed{0};
+            auto work = [&](int worker, std::size_t b, std::size_t e) {
+                auto& out = improved_[worker];
+                long long count = 0;
+                for (std::size_t i = b; i < e; ++i) {
+                    int u = list[i];
+                    Distance du = dist_[u].load(std::memory_order_relaxed);
+                    for (auto [v, w] : g[u]) {
+                        if ((static_cast<Distance>(w) <= delta_) != light) continue;
+                        ++count;
+                        Distance nd = du + static_cast<Distance>(w);
+                        Distance cur = dist_[v].load(std::memory_order_relaxed);
+                        while (nd < cur) {
+                            if (dist_[v].compare_exchange_weak(cur, nd, std::memory_order_relaxed)) {
+                                out.push_back(v);
+                                break;
+                            }
+                        }
+                    }
+                }
+                relaxed.fetch_add(count, std::memory_order_relaxed);
+            };
+
+            if (list.size() < kParallelThreshold) work(0, 0, list.size());
+            else pool_->forChunks(list.size(), work);
+            relaxations_ += relaxed.load();
+        }
+
+        void distribute(long long window) {
+            for (auto& out : improved_) {
+                for (int v : out) {
+                    buckets_[(dist_[v].load(std::memory_order_relaxed) / delta_) % window].push_back(v);
+                }
+                out.clear();
+            }
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "graph/delta_stepping.hpp"
+#include "graph/dijkstra.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    algo::CsrGraph<int> randomGraph(int n, int m, int maxW, unsigned seed) {
+        mt19937 rng(seed);
+        vector<algo::CsrGraph<int>::Edge> edges(m);
+        for (auto& e : edges) e = {(int) (rng() % n), (int) (rng() % n), (int) (rng() % maxW)};
+        return algo::CsrGraph<int>(n, edges);
+    }
+
+    void expectSameAsDijkstra(const algo::CsrGraph<int>& g, algo::DeltaStepping& ds, int s, long long delta) {
+        algo::Dijkstra dijkstra;
+        dijkstra.run(g, s);
+        ds.run(g, s, delta);
+        for (int v = 0; v < g.size(); v++) {
+            ASSERT_EQ(ds.distance(v), dijkstra.distance(v)) << "vertex " << v << " delta " << delta;
+        }
+    }
+}
+
+TEST(DeltaSteppingTest, SequentialMatchesDijkstra) {
+    auto g = randomGraph(500, 4000, 1000, 1);
+    algo::DeltaStepping ds;
+    for (long long delta : {1LL, 7LL, 100LL, 1000000000LL, 0LL}) {
+        expectSameAsDijkstra(g, ds, 0, delta);
+    }
+}
+
+TEST(DeltaSteppingTest, ParallelMatchesDijkstra) {
+    auto g = randomGraph(20000, 200000, 10000, 2);
+    algo::ThreadPool pool(4);
+    algo::DeltaStepping ds(&pool);
+    expectSameAsDijkstra(g, ds, 0, 0);
+    expectSameAsDijkstra(g, ds, 123, 50);
+    EXPECT_GT(ds.relaxations(), 0);
+    EXPECT_GT(ds.phases(), 0);
+}
+
+TEST(DeltaSteppingTest, AutoDeltaAndEdgeCases) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 0}, {1, 2, 0}, {3, 3, 5}};
+    algo::CsrGraph<int> g(5, edges);
+    EXPECT_EQ(algo::DeltaStepping::autoDelta(g), 5);
+
+    algo::DeltaStepping ds;
+    ds.run(g, 0);
+    EXPECT_EQ(ds.distance(2), 0);
+    EXPECT_EQ(ds.distance(3), algo::DeltaStepping::kInfinity);
+
+    vector<algo::CsrGraph<int>::Edge> negative = {{0, 1, -1}};
+    EXPECT_THROW(ds.run(algo::CsrGraph<int>(2, negative), 0), std::invalid_argument);
+    EXPECT_THROW(ds.run(g, 5), std::out_of_range);
+}
+
+TEST(DeltaSteppingTest, TinyDeltaWithHugeWeightsIsClamped) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 1000000000}, {1, 2, 3}, {0, 2, 1000000002}};
+    algo::CsrGraph<int> g(3, edges);
+    algo::DeltaStepping ds;
+    ds.run(g, 0, 1);
+    EXPECT_GE(ds.delta(), 1000000000LL / algo::DeltaStepping::kMaxBuckets);
+    EXPECT_EQ(ds.distance(1), 1000000000);
+    EXPECT_EQ(ds.distance(2), 1000000002);
+}
@@ -1,15 +1,18 @@
 #include <iostream>
 #include <vector>
 
+#include "graph/csr_graph.hpp"
+
 using namespace std;
 
 /// @brief Implements the Dijkstra to find the shortest paths in a graph.
 /// @param G The graph represented as an adjacency list where G[u] is a vector of pairs (v, d),
-///          indicating a directed edge from u to v with weight d.
+///          indicating a directed edge from u to v with weight d, or an algo::CsrGraph<int>.
 /// @param ret A vector to store the computed shortest distances from the source vertex 's' to all other vertices.
 /// @param s The source vertex from which shortest paths are calculated.
 /// @param n The total number of vertices in the graph.
-void dijkstra(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n) {
+template <typename Graph>
+void dijkstra(const Graph &G, vector<int> &ret, int s, int n) {
     vector<char> vis(n, 0);
     ret.resize(n, -1);
     ret[s] = 0;
@@ -19,7 +22,7 @@ void dijkstra(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n)
             if (vis[j] == 0 && ret[j] != -1 && (k == -1 || ret[k] > ret[j])) k = j;
         vis[k] = 1;
         
-        for (auto &e : G[k]) {
+        for (auto e : G[k]) {
             if (ret[e.first] == -1 || ret[e.first] > ret[k] + e.second) {
                 ret[e.first] = ret[k] + e.second;
             }
@@ -27,11 +30,13 @@ void dijkstra(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n)
     }
 }
 
-inline void dijkstra(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s) {
+template <typename Graph>
+inline void dijkstra(const Graph &G, vector<int> &ret, int s) {
     dijkstra(G, ret, s, G.size());
 }
 
-inline void dijkstra(vector<vector<pair<int, int>>> &G, vector<int> &ret) {
+template <typename Graph>
+inline void dijkstra(const Graph &G, vector<int> &ret) {
     dijkstra(G, ret, 0, G.size());
 }
 
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "data_structure/indexed_heap.hpp"
+#include "data_structure/radix_heap.hpp"
+
+namespace algo {
+
+    // Single-source shortest paths with non-negative integer weights, 64-bit
+    // distances.
+    //
+    // Frontier:
+    //   Heap  : indexed 4-ary heap with decrease-key, O((n + m) log n). Default.
+    //   Radix : monotone radix heap, integer weights only; fastest for sparse
+    //           graphs with small integer weights.
+    //   Dense : O(n^2) array scan without a heap, best for complete graphs.
+    //
+    // The object is a reusable workspace: distances, predecessors and the heap
+    // persist between run() calls, and only the vertices touched by the
+    // previous query are reset, so a query costs nothing proportional to n
+    // unless it actually reaches the whole graph.
+    //
+    // Graph is anything with G.size() and `for (auto [v, w] : G[u])`, e.g.
+    // std::vector<std::vector<std::pair<int, int>>>.
+    class Dijkstra {
+    public:
+        using Distance = long long;
+        static constexpr Distance kInfinity = std::numeric_limits<Distance>::max();
+
+        enum class Frontier { Heap, Radix, Dense };
+
+        explicit Dijkstra(int n = 0, Frontier frontier = Frontier::Heap, bool trackPredecessors = false)
+            : frontier_(frontier), trackPredecessors_(trackPredecessors) {
+            grow(n);
+        }
+
+        template <typename Graph>
+        void run(const Graph& G, int s) {
+            run(G, std::span<const int>(&s, 1));
+        }
+
+        // Multi-source run: every source starts at distance 0, so each vertex
+        // gets its distance to the nearest source.
+        template <typename Graph>
+        void run(const Graph& G, std::span<const int> sources) {
+            const int n = static_cast<int>(G.size());
+            for (int s : sources) {
+                if (s < 0 || s >= n) throw std::out_of_range("Dijkstra: source out of range");
+            }
+            clear();
+            grow(n);
+
+            for (int s : sources) {
+                touch(s);
+                dist_[s] = 0;
+            }
+            switch (frontier_) {
+            case Frontier::Heap: runHeap(G, sources); break;
+            case Frontier::Radix: runRadix(G, sources); break;
+            case Frontier::Dense: runDense(G, n); break;
+            }
+        }
+
+        // kInfinity when v was not reached by the last run.
+        Distance distance(int v) const { return dist_[v]; }
+        bool reached(int v) const { return dist_[v] != kInfinity; }
+
+        // Previous vertex on a shortest path; -1 for the source and unreached vertices.
+        int predecessor(int v) const {
+            requirePredecessors();
+            return pred_[v];
+        }
+
+        // Vertices of a shortest path from the (nearest) source of the last run to t;
+        // empty if unreachable.
+        std::vector<int> path(int t) const {
+            requirePredecessors();
+            std::vector<int> ret;
+            if (!reached(t)) return ret;
+            for (int v = t; v != -1; v = pred_[v]) ret.push_back(v);
+            std::reverse(ret.begin(), ret.end());
+            return ret;
+        }
+
+        // Distances indexed by vertex; entries past the last graph size are kInfinity.
+        const std::vector<Distance>& distances() const { return dist_; }
+
+        // Vertices whose distance was set by the last run.
+        const std::vector<int>& touched() const { return touched_; }
+
+    private:
+        Frontier frontier_;
+        bool trackPredecessors_;
+        std::vector<Distance> dist_;
+        std::vector<int> pred_;
+        std::vector<char> done_;
+        std::vector<int> touched_;
+        IndexedHeap<Distance> heap_;
+        RadixHeap<std::uint64_t, int> radix_;
+
+        void grow(int n) {
+            if (n <= static_cast<int>(dist_.size())) return;
+            dist_.resize(n, kInfinity);
+            done_.resize(n, 0);
+            if (trackPredecessors_) pred_.resize(n, -1);
+            heap_.resize(n);
+        }
+
+        void clear() {
+            for (int v : touched_) {
+                dist_[v] = kInfinity;
+                done_[v] = 0;
+                if (trackPredecessors_) pred_[v] = -1;
+            }
+            touched_.clear();
+            heap_.reset();
+            radix_.clear();
+        }
+
+        void touch(int v) {
+            if (dist_[v] == kInfinity) touched_.push_back(v);
+        }
+
+        void requirePredecessors() const {
+            if (!trackPredecessors_) throw std::logic_error("Dijkstra: predecessor tracking is disabled");
+        }
+
+        // Returns true when v improved.
+        template <typename Weight>
+        bool relax(int u, int v, Weight w) {
+            static_assert(std::is_integral_v<Weight>, "Dijkstra needs integer weights.");
+            if constexpr (std::is_signed_v<Weight>) {
+                if (w < 0) throw std::invalid_argument("Dijkstra: negative edge weight");
+            }
+            Distance nd = dist_[u] + static_cast<Distance>(w);
+            if (nd >= dist_[v]) return false;
+            touch(v);
+            dist_[v] = nd;
+            if (trackPredecessors_) pred_[v] = u;
+            return true;
+        }
+
+        template <typename Graph>
+        void runHeap(const Graph& G, std::span<const int> sources) {
+            for (int s : sources) {
+                if (!heap_.contains(s)) heap_.push(s, 0);
+            }
+            while (!heap_.empty()) {
+                int u = heap_.pop();
+                done_[u] = 1;
+                for (auto [v, w] : G[u]) {
+                    if (done_[v] || !relax(u, v, w)) continue;
+                    heap_.update(v, dist_[v]);
+                }
+            }
+        }
+
+        template <typename Graph>
+        void runRadix(const Graph& G, std::span<const int> sources) {
+            for (int s : sources) radix_.push(0, s);
+            while (!radix_.empty()) {
+                auto [d, u] = radix_.pop();
+                if (done_[u] || static_cast<Distance>(d) != dist_[u]) continue;
+                done_[u] = 1;
+                for (auto [v, w] : G[u]) {
+                    if (done_[v] || !relax(u, v, w)) continue;
+                    radix_.push(static_cast<std::uint64_t>(dist_[v]), v);
+                }
+            }
+        }
+
+        template <typename Graph>
+        void runDense(const Graph& G, int n) {
+            for (;;) {
+                int k = -1;
+                for (int j = 0; j < n; ++j) {
+                    if (!done_[j] && dist_[j] != kInfinity && (k == -1 || dist_[j] < dist_[k])) k = j;
+                }
+                if (k == -1) break;
+                done_[k] = 1;
+                for (auto [v, w] : G[k]) {
+                    if (!done_[v]) relax(k, v, w);
+                }
+            }
+        }
+    };
+
+} // namespace algo
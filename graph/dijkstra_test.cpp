@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "graph/dijkstra.hpp"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    using AdjList = vector<vector<pair<int, int>>>;
+
+    // Floyd-Warshall reference; -1 marks unreachable.
+    vector<vector<long long>> allPairs(const AdjList& G) {
+        const int n = G.size();
+        const long long inf = algo::Dijkstra::kInfinity;
+        vector<vector<long long>> g(n, vector<long long>(n, inf));
+        for (int i = 0; i < n; i++) {
+            g[i][i] = 0;
+            for (auto [j, w] : G[i]) g[i][j] = min(g[i][j], (long long) w);
+        }
+        for (int k = 0; k < n; k++)
+            for (int i = 0; i < n; i++)
+                for (int j = 0; j < n; j++)
+                    if (g[i][k] != inf && g[k][j] != inf && g[i][k] + g[k][j] < g[i][j])
+                        g[i][j] = g[i][k] + g[k][j];
+        return g;
+    }
+
+    AdjList randomGraph(int n, int m, int maxW, unsigned seed) {
+        mt19937 rng(seed);
+        AdjList G(n);
+        for (int i = 0; i < m; i++) {
+            G[rng() % n].push_back({(int) (rng() % n), (int) (rng() % maxW)});
+        }
+        return G;
+    }
+}
+
+TEST(DijkstraTest, AllFrontiersMatchFloyd) {
+    auto G = randomGraph(120, 600, 10000, 1);
+    auto expected = allPairs(G);
+
+    for (auto frontier : {algo::Dijkstra::Frontier::Heap,
+                          algo::Dijkstra::Frontier::Radix,
+                          algo::Dijkstra::Frontier::Dense}) {
+        algo::Dijkstra dijkstra(G.size(), frontier);
+        for (int s = 0; s < (int) G.size(); s++) {
+            dijkstra.run(G, s);
+            for (int t = 0; t < (int) G.size(); t++) {
+                ASSERT_EQ(dijkstra.distance(t), expected[s][t]);
+            }
+        }
+    }
+}
+
+TEST(DijkstraTest, CompleteGraphDenseMode) {
+    // Same shape as test_dijkstra in dijkstra.cpp.
+    const int N = 100;
+    mt19937 rng(5);
+    AdjList G(N);
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++)
+            G[i].push_back({j, (int) (rng() % 10000 + rng() % 10000)});
+    auto expected = allPairs(G);
+
+    algo::Dijkstra dense(N, algo::Dijkstra::Frontier::Dense);
+    for (int s = 0; s < N; s++) {
+        dense.run(G, s);
+        for (int t = 0; t < N; t++) ASSERT_EQ(dense.distance(t), expected[s][t]);
+    }
+}
+
+TEST(DijkstraTest, PredecessorsAndPaths) {
+    AdjList G(5);
+    G[0] = {{1, 4}, {2, 1}};
+    G[2] = {{1, 2}, {3, 7}};
+    G[1] = {{3, 1}};
+
+    algo::Dijkstra dijkstra(5, algo::Dijkstra::Frontier::Heap, true);
+    dijkstra.run(G, 0);
+    EXPECT_EQ(dijkstra.distance(3), 4);
+    EXPECT_EQ(dijkstra.path(3), (vector<int>{0, 2, 1, 3}));
+    EXPECT_EQ(dijkstra.predecessor(0), -1);
+    EXPECT_FALSE(dijkstra.reached(4));
+    EXPECT_TRUE(dijkstra.path(4).empty());
+
+    algo::Dijkstra untracked(5);
+    untracked.run(G, 0);
+    EXPECT_THROW(untracked.path(3), std::logic_error);
+}
+
+TEST(DijkstraTest, LongDistancesDoNotOverflow) {
+    const int n = 4;
+    const int big = 2000000000;
+    AdjList G(n);
+    for (int i = 0; i + 1 < n; i++) G[i].push_back({i + 1, big});
+
+    algo::Dijkstra dijkstra(n, algo::Dijkstra::Frontier::Radix);
+    dijkstra.run(G, 0);
+    EXPECT_EQ(dijkstra.distance(3), 3LL * big);
+}
+
+TEST(DijkstraTest, WorkspaceReuseResetsTouchedVertices) {
+    AdjList a(4), b(6);
+    a[0] = {{1, 1}, {2, 5}};
+    b[3] = {{5, 2}};
+
+    algo::Dijkstra dijkstra;
+    dijkstra.run(a, 0);
+    EXPECT_EQ(dijkstra.distance(2), 5);
+
+    dijkstra.run(b, 3);
+    EXPECT_FALSE(dijkstra.reached(0));
+    EXPECT_FALSE(dijkstra.reached(2));
+    EXPECT_EQ(dijkstra.distance(3), 0);
+    EXPECT_EQ(dijkstra.distance(5), 2);
+    EXPECT_EQ(dijkstra.touched().size(), 2u);
+
+    AdjList negative(2);
+    negative[0] = {{1, -1}};
+    EXPECT_THROW(dijkstra.run(negative, 0), std::invalid_argument);
+    EXPECT_THROW(dijkstra.run(a, 7), std::out_of_range);
+}
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+#include "misc/mapped_file.hpp"
+
+namespace algo {
+
+    // Binary CSR graph files that are used in place through mmap.
+    //
+    // Layout (native endianness, every section starts on an 8-byte boundary):
+    //
+    //   header   magic "ALGOCSR\0", version, flags, weight type, n, m and
+    //            the byte offset of every section
+    //   offsets  int64[n + 1]
+    //   targets  int32[m]
+    //   weights  W[m]
+    //   reverse  int64[m]       only with kHasReverse
+    //
+    // load() maps the file and returns a CsrGraph whose arrays point into the
+    // mapping; nothing is copied, pages are read on first touch and shared
+    // with the page cache, and the mapping lives as long as any copy of the
+    // graph. Anything that takes a CsrGraph (Dijkstra, DeltaStepping,
+    // MaxFlow, MinimumSpanningTree, Lca, ...) runs on it directly.
+    //
+    // The weight type is recorded (integer/unsigned/floating and size) and
+    // must match W on load. With `verify` set, load() also checks that the
+    // offsets are monotone and every target and reverse index is in range,
+    // one sequential pass over the file; skip it for trusted files to keep
+    // loading O(1). Malformed files throw std::runtime_error.
+    //
+    // convertEdgeList() turns a text edge list ("u v" or "u v w" per line,
+    // '#' and '%' start comments, missing weights are 1) into a graph file
+    // without holding the edges in memory: one pass over the mapped text
+    // counts the arcs per vertex, a second pass scatters every arc straight
+    // into the mapped output file. It builds the same arrays as
+    // CsrGraph(n, edges, options) and needs O(n) memory besides the two
+    // mappings.
+    //
+    // load() maps with MappedFile::Access::Normal: the algorithms read the
+    // arrays in random order, so the sequential read-ahead hint would evict
+    // the wrong pages.
+    class GraphFile {
+    public:
+        static constexpr std::uint32_t kVersion = 1;
+        static constexpr std::uint32_t kHasReverse = 1;
+
+        struct Info {
+            std::uint32_t version = 0;
+            std::uint32_t flags = 0;
+            std::uint32_t weightKind = 0;
+            std::uint32_t weightSize = 0;
+            long long vertices = 0;
+            long long arcs = 0;
+
+            bool hasReverse() const { return (flags & kHasReverse) != 0; }
+        };
+
+        template <typename W>
+        static void write(const std::string& path, const CsrGraph<W>& g) {
+            static_assert(std::is_trivially_copyable_v<W>, "GraphFile: weights must be trivially copyable");
+            const Header h = makeHeader<W>(g.size(), static_cast<std::uint64_t>(g.edgeCount()), g.hasReverse());
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("GraphFile: cannot write " + path);
+            std::uint64_t at = 0;
+            writeSection(out, at, 0, std::span<const Header>(&h, 1));
+            writeSection(out, at, h.offsets, g.offsets());
+            writeSection(out, at, h.targets, g.targets());
+            writeSection(out, at, h.weights, g.weights());
+            if (g.hasReverse()) writeSection(out, at, h.reverse, g.reverseIndex());
+            if (!out) throw std::runtime_error("GraphFile: short write to " + path);
+        }
+
+        template <typename W>
+        static CsrGraph<W> load(const std::string& path, bool verify = true) {
+            auto file = std::make_shared<const MappedFile>(path, MappedFile::Access::Normal);
+            const Header h = readHeader(*file, path);
+            if (h.weightKind != weightKind<W>() || h.weightSize != sizeof(W)) {
+                throw std::runtime_error("GraphFile: weight type of " + path + " does not match");
+            }
+            const std::size_t n = h.vertices, m = h.arcs;
+            auto offsets = section<long long>(*file, h.offsets, n + 1, path);
+            auto targets = section<int>(*file, h.targets, m, path);
+            auto weights = section<W>(*file, h.weights, m, path);
+            std::span<const long long> reverse;
+            if (h.flags & kHasReverse) reverse = section<long long>(*file, h.reverse, m, path);
+
+            if (offsets.front() != 0 || offsets.back() != static_cast<long long>(m)) {
+                throw std::runtime_error("GraphFile: corrupt offsets in " + path);
+            }
+            if (verify) check(offsets, targets, reverse, path);
+            return CsrGraph<W>::fromView(std::move(file), offsets, targets, weights, reverse);
+        }
+
+        static Info info(const std::string& path) {
+            MappedFile file(path);
+            return toInfo(readHeader(file, path));
+        }
+
+        // Build the CSR from a text edge list and write it to `graphPath`.
+        // Vertices are 0 .. n - 1; with n < 0 the largest id + 1 is used.
+        // options.pool is ignored. Throws std::out_of_range for an id >= n, or,
+        // with n < 0, for an id >= INT_MAX - 1 (the header caps vertices there).
+        template <typename W = int>
+        static Info convertEdgeList(const std::string& textPath, const std::string& graphPath, int n = -1,
+                                    const typename CsrGraph<W>::BuildOptions& options = {}) {
+            static_assert(std::is_trivially_copyable_v<W>, "GraphFile: weights must be trivially copyable");
+            const MappedFile text(textPath, MappedFile::Access::Sequential);
+            const char* const begin = text.data();
+            const char* const end = begin + text.size();
+            const bool twoArcs = options.undirected || options.reverseEdges;
+            typename CsrGraph<W>::Edge e;
+
+            // Pass 1: arcs per vertex; becomes the scatter cursor in pass 2.
+            std::vector<long long> cursor(n > 0 ? n : 0, 0);
+            std::uint64_t m = 0;
+            for (const char* p = begin; nextTextEdge(p, end, begin, e);) {
+                const int top = std::max(e.from, e.to);
+                if (top >= static_cast<int>(cursor.size())) {
+                    if (n >= 0 || top >= std::numeric_limits<int>::max() - 1) {
+                        throw std::out_of_range("GraphFile: edge (" + std::to_string(e.from) + ", " +
+                                                std::to_string(e.to) + ") out of range");
+                    }
+                    if (static_cast<std::size_t>(top) >= cursor.capacity()) {
+                        cursor.reserve(std::max(2 * cursor.capacity(), static_cast<std::size_t>(top) + 1));
+                    }
+                    cursor.resize(static_cast<std::size_t>(top) + 1, 0);
+                }
+                ++cursor[e.from];
+                if (twoArcs) ++cursor[e.to];
+                m += twoArcs ? 2 : 1;
+            }
+            if (n < 0) n = static_cast<int>(cursor.size());
+
+            const Header h = makeHeader<W>(n, m, options.reverseEdges);
+            const std::uint64_t bytes = options.reverseEdges ? h.reverse + m * sizeof(long long)
+                                                             : h.weights + m * sizeof(W);
+            MappedFile out = MappedFile::create(graphPath, static_cast<std::size_t>(bytes));
+            char* base = out.writableData();
+            std::memcpy(base, &h, sizeof(Header));
+            auto* offsets = reinterpret_cast<long long*>(base + h.offsets);
+            auto* targets = reinterpret_cast<int*>(base + h.targets);
+            auto* weights = reinterpret_cast<W*>(base + h.weights);
+            auto* reverse = options.reverseEdges ? reinterpret_cast<long long*>(base + h.reverse) : nullptr;
+            offsets[0] = 0;
+            for (int u = 0; u < n; ++u) {
+                offsets[u + 1] = offsets[u] + cursor[u];
+                cursor[u] = offsets[u];
+            }
+
+            // Pass 2: same placement as CsrGraph's sequential build.
+            for (const char* p = begin; nextTextEdge(p, end, begin, e);) {
+                const long long fwd = cursor[e.from]++;
+                targets[fwd] = e.to;
+                weights[fwd] = e.weight;
+                if (!twoArcs) continue;
+                const long long back = cursor[e.to]++;
+                targets[back] = e.from;
+                weights[back] = options.undirected ? e.weight : W{};
+                if (reverse != nullptr) {
+                    reverse[fwd] = back;
+                    reverse[back] = fwd;
+                }
+            }
+            out.sync();
+            return toInfo(h);
+        }
+
+    private:
+        static constexpr char kMagic[8] = {'A', 'L', 'G', 'O', 'C', 'S', 'R', '\0'};
+
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t flags;
+            std::uint32_t weightKind;
+            std::uint32_t weightSize;
+            std::uint64_t vertices;
+            std::uint64_t arcs;
+            std::uint64_t offsets;
+            std::uint64_t targets;
+            std::uint64_t weights;
+            std::uint64_t reverse;
+        };
+        static_assert(sizeof(Header) % 8 == 0);
+
+        // 0 signed integer, 1 unsigned integer, 2 floating point, 3 other.
+        template <typename W>
+        static constexpr std::uint32_t weightKind() {
+            if constexpr (std::is_floating_point_v<W>) return 2;
+            else if constexpr (std::is_integral_v<W>) return std::is_signed_v<W> ? 0 : 1;
+            else return 3;
+        }
+
+        static constexpr std::uint64_t align(std::uint64_t at) { return (at + 7) & ~std::uint64_t{7}; }
+
+        template <typename W>
+        static Header makeHeader(int n, std::uint64_t m, bool hasReverse) {
+            Header h{};
+            std::memcpy(h.magic, kMagic, sizeof(kMagic));
+            h.version = kVersion;
+            h.flags = hasReverse ? kHasReverse : 0;
+            h.weightKind = weightKind<W>();
+            h.weightSize = sizeof(W);
+            h.vertices = static_cast<std::uint64_t>(n);
+            h.arcs = m;
+            h.offsets = sizeof(Header);
+            h.targets = align(h.offsets + (h.vertices + 1) * sizeof(long long));
+            h.weights = align(h.targets + h.arcs * sizeof(int));
+            h.reverse = hasReverse ? align(h.weights + h.arcs * sizeof(W)) : 0;
+            return h;
+        }
+
+        static Info toInfo(const Header& h) {
+            return {h.version, h.flags, h.weightKind, h.weightSize, static_cast<long long>(h.vertices),
+                    static_cast<long long>(h.arcs)};
+        }
+
+        template <typename T>
+        static void writeSection(std::ofstream& out, std::uint64_t& at, std::uint64_t start, std::span<const T> a) {
+            static constexpr char zeros[8] = {};
+            out.write(zeros, static_cast<std::streamsize>(start - at));
+            out.write(reinterpret_cast<const char*>(a.data()), static_cast<std::streamsize>(a.size_bytes()));
+            at = start + a.size_bytes();
+        }
+
+        static Header readHeader(const MappedFile& file, const std::string& path) {
+            Header h{};
+            if (file.size() < sizeof(Header)) throw std::runtime_error("GraphFile: bad file " + path);
+            std::memcpy(&h, file.data(), sizeof(Header));
+            if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) {
+                throw std::runtime_error("GraphFile: bad file " + path);
+            }
+            if (h.version != kVersion) throw std::runtime_error("GraphFile: unsupported version in " + path);
+            if (h.vertices > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) - 1 ||
+                h.arcs > static_cast<std::uint64_t>(std::numeric_limits<long long>::max()) / 8) {
+                throw std::runtime_error("GraphFile: bad sizes in " + path);
+            }
+            return h;
+        }
+
+        template <typename T>
+        static std::span<const T> section(const MappedFile& file, std::uint64_t start, std::size_t count,
+                                          const std::string& path) {
+            if (start % alignof(T) != 0 || start > file.size() || count > (file.size() - start) / sizeof(T)) {
+                throw std::runtime_error("GraphFile: truncated file " + path);
+            }
+            const char* p = file.data() + start;
+            if (reinterpret_cast<std::uintptr_t>(p) % alignof(T) != 0) {
+                throw std::runtime_error("GraphFile: misaligned mapping of " + path);
+            }
+            return {reinterpret_cast<const T*>(p), count};
+        }
+
+        static void check(std::span<const long long> offsets, std::span<const int> targets,
+                          std::span<const long long> reverse, const std::string& path) {
+            const int n = static_cast<int>(offsets.size()) - 1;
+            const long long m = static_cast<long long>(targets.size());
+            for (int u = 0; u < n; ++u) {
+                if (offsets[u] > offsets[u + 1]) throw std::runtime_error("GraphFile: corrupt offsets in " + path);
+            }
+            for (int v : targets) {
+                if (v < 0 || v >= n) throw std::runtime_error("GraphFile: corrupt arc in " + path);
+            }
+            for (long long e = 0; e < static_cast<long long>(reverse.size()); ++e) {
+                long long r = reverse[e];
+                if (r < 0 || r >= m || reverse[r] != e) {
+                    throw std::runtime_error("GraphFile: corrupt reverse index in " + path);
+                }
+            }
+        }
+
+        template <typename Edge>
+        static bool nextTextEdge(const char*& p, const char* end, const char* base, Edge& e) {
+            auto blank = [&] { while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p; };
+            for (;;) {
+                while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) ++p;
+                if (p == end) return false;
+                if (*p != '#' && *p != '%') break;
+                while (p < end && *p != '\n') ++p;
+            }
+
+            const char* line = p;
+            auto r = std::from_chars(p, end, e.from);
+            if (r.ec == std::errc()) {
+                p = r.ptr;
+                blank();
+                r = std::from_chars(p, end, e.to);
+            }
+            if (r.ec == std::errc()) {
+                p = r.ptr;
+                blank();
+                e.weight = 1;
+                if (p < end && *p != '\n' && *p != '#' && *p != '%') {
+                    r = std::from_chars(p, end, e.weight);
+                    p = r.ptr;
+                    blank();
+                    // Anything but a comment after the weight is an error.
+                    if (r.ec == std::errc() && p < end && *p != '\n' && *p != '#' && *p != '%') {
+                        r.ec = std::errc::invalid_argument;
+                    }
+                }
+            }
+            if (r.ec != std::errc() || e.from < 0 || e.to < 0) {
+                throw std::runtime_error("GraphFile: malformed edge at byte " + std::to_string(line - base));
+            }
+            while (p < end && *p != '\n') ++p;
+            return true;
+        }
+    };
+
+} // namespace algo
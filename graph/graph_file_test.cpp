@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include "graph/dijkstra.hpp"
+#include "graph/graph_file.hpp"
+#include "graph/lca.hpp"
+#include "graph/max_flow.hpp"
+#include "graph/minimum_spanning_tree.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    string tempPath(const string& name) {
+        return (filesystem::temp_directory_path() / name).string();
+    }
+
+    template <typename W>
+    vector<typename algo::CsrGraph<W>::Edge> randomEdges(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        vector<typename algo::CsrGraph<W>::Edge> edges;
+        for (int i = 0; i < m; i++) edges.push_back({(int) (rng() % n), (int) (rng() % n), (W) (1 + rng() % 100)});
+        return edges;
+    }
+
+    void overwrite(const string& path, size_t at, const void* bytes, size_t size) {
+        fstream f(path, ios::binary | ios::in | ios::out);
+        f.seekp(static_cast<streamoff>(at));
+        f.write(static_cast<const char*>(bytes), static_cast<streamsize>(size));
+    }
+}
+
+TEST(GraphFileTest, RoundTrip) {
+    const string path = tempPath("algo_graph_file_round_trip.bin");
+    algo::CsrGraph<long long>::BuildOptions options;
+    options.reverseEdges = true;
+    algo::CsrGraph<long long> g(300, randomEdges<long long>(300, 2000, 1), options);
+    algo::GraphFile::write(path, g);
+
+    auto info = algo::GraphFile::info(path);
+    EXPECT_EQ(info.version, algo::GraphFile::kVersion);
+    EXPECT_EQ(info.vertices, 300);
+    EXPECT_EQ(info.arcs, g.edgeCount());
+    EXPECT_TRUE(info.hasReverse());
+    EXPECT_EQ(info.weightSize, sizeof(long long));
+
+    auto loaded = algo::GraphFile::load<long long>(path);
+    EXPECT_EQ(loaded.size(), g.size());
+    EXPECT_TRUE(loaded.hasReverse());
+    EXPECT_TRUE(ranges::equal(loaded.offsets(), g.offsets()));
+    EXPECT_TRUE(ranges::equal(loaded.targets(), g.targets()));
+    EXPECT_TRUE(ranges::equal(loaded.weights(), g.weights()));
+    EXPECT_TRUE(ranges::equal(loaded.reverseIndex(), g.reverseIndex()));
+
+    // Empty graph and a graph without arcs.
+    algo::GraphFile::write(path, algo::CsrGraph<int>());
+    EXPECT_EQ(algo::GraphFile::load<int>(path).size(), 0);
+    algo::GraphFile::write(path, algo::CsrGraph<int>(5, {}));
+    auto isolated = algo::GraphFile::load<int>(path);
+    EXPECT_EQ(isolated.size(), 5);
+    EXPECT_EQ(isolated.degree(4), 0);
+}
+
+TEST(GraphFileTest, ConvertMatchesInMemoryBuild) {
+    const string text = tempPath("algo_graph_file_convert.txt");
+    const string path = tempPath("algo_graph_file_convert.bin");
+    auto edges = randomEdges<int>(200, 1500, 7);
+    {
+        ofstream out(text);
+        for (auto& e : edges) out << e.from << ' ' << e.to << ' ' << e.weight << " # note\n";
+    }
+    int maxId = 0;
+    for (auto& e : edges) maxId = max({maxId, e.from, e.to});
+
+    for (int mode = 0; mode < 4; mode++) {
+        algo::CsrGraph<int>::BuildOptions options;
+        options.undirected = mode & 1;
+        options.reverseEdges = mode & 2;
+        algo::CsrGraph<int> g(maxId + 1, edges, options);
+        auto info = algo::GraphFile::convertEdgeList<int>(text, path, -1, options);
+        EXPECT_EQ(info.vertices, maxId + 1);
+        EXPECT_EQ(info.arcs, g.edgeCount());
+        EXPECT_EQ(info.hasReverse(), options.reverseEdges);
+
+        auto loaded = algo::GraphFile::load<int>(path);
+        EXPECT_TRUE(ranges::equal(loaded.offsets(), g.offsets()));
+        EXPECT_TRUE(ranges::equal(loaded.targets(), g.targets()));
+        EXPECT_TRUE(ranges::equal(loaded.weights(), g.weights()));
+        EXPECT_TRUE(ranges::equal(loaded.reverseIndex(), g.reverseIndex()));
+    }
+
+    EXPECT_EQ(algo::GraphFile::convertEdgeList<int>(text, path, 250).vertices, 250);
+    EXPECT_THROW(algo::GraphFile::convertEdgeList<int>(text, path, maxId), out_of_range);
+
+    // Trailing fields are rejected, not ignored.
+    ofstream(text) << "0 1 5\n1 2 3 4\n";
+    EXPECT_THROW(algo::GraphFile::convertEdgeList<int>(text, path), runtime_error);
+    ofstream(text) << "0 1 5x\n";
+    EXPECT_THROW(algo::GraphFile::convertEdgeList<int>(text, path), runtime_error);
+    ofstream(text) << "";
+    EXPECT_EQ(algo::GraphFile::convertEdgeList<int>(text, path).vertices, 0);
+}
+
+TEST(GraphFileTest, LoadDoesNotCopy) {
+    const string path = tempPath("algo_graph_file_view.bin");
+    algo::CsrGraph<int> g(100, randomEdges<int>(100, 500, 2));
+    algo::GraphFile::write(path, g);
+
+    algo::CsrGraph<int> copy;
+    {
+        auto loaded = algo::GraphFile::load<int>(path);
+        // The arrays sit in one mapping, as far apart as their file sections
+        // (offsets at byte 72, targets at 72 + 101 * 8, weights 500 * 4 later).
+        auto bytes = [](const void* a, const void* b) {
+            return static_cast<const char*>(b) - static_cast<const char*>(a);
+        };
+        EXPECT_EQ(bytes(loaded.offsets().data(), loaded.targets().data()), 101 * 8);
+        EXPECT_EQ(bytes(loaded.targets().data(), loaded.weights().data()), 500 * 4);
+        copy = loaded;
+        EXPECT_EQ(copy.targets().data(), loaded.targets().data());
+    }
+    // The copy keeps the mapping alive after the original is gone.
+    EXPECT_TRUE(ranges::equal(copy.targets(), g.targets()));
+    EXPECT_TRUE(ranges::equal(copy.weights(), g.weights()));
+}
+
+TEST(GraphFileTest, AlgorithmsRunOnMappedGraph) {
+    const string text = tempPath("algo_graph_file_edges.txt");
+    const string path = tempPath("algo_graph_file_edges.bin");
+    const int n = 400;
+    auto edges = randomEdges<long long>(n, 3000, 3);
+    {
+        ofstream out(text);
+        out << "# u v w\n";
+        for (auto& e : edges) out << e.from << ' ' << e.to << '\t' << e.weight << "\r\n";
+        out << "% trailing comment\n" << n - 1 << ' ' << 0 << '\n';
+    }
+    edges.push_back({n - 1, 0, 1});
+    auto info = algo::GraphFile::convertEdgeList<long long>(text, path);
+    EXPECT_EQ(info.vertices, n);
+    EXPECT_EQ(info.arcs, (long long) edges.size());
+
+    auto mapped = algo::GraphFile::load<long long>(path);
+    algo::CsrGraph<long long> g(n, edges);
+    EXPECT_TRUE(ranges::equal(mapped.weights(), g.weights()));
+
+    algo::Dijkstra a, b;
+    a.run(mapped, 0);
+    b.run(g, 0);
+    for (int v = 0; v < n; v++) EXPECT_EQ(a.distance(v), b.distance(v));
+
+    algo::MaxFlow fa(mapped), fb(g);
+    EXPECT_EQ(fa.dinic(0, n - 1), fb.dinic(0, n - 1));
+
+    auto ta = algo::MinimumSpanningTree<long long>(mapped).solve();
+    auto tb = algo::MinimumSpanningTree<long long>(g).solve();
+    long long wa = 0, wb = 0;
+    for (auto& e : ta) wa += e.weight;
+    for (auto& e : tb) wb += e.weight;
+    EXPECT_EQ(wa, wb);
+
+    // Undirected tree for Lca: parent of i is a random earlier vertex.
+    mt19937 rng(4);
+    {
+        ofstream out(text);
+        for (int i = 1; i < n; i++) out << rng() % i << ' ' << i << '\n';
+    }
+    algo::CsrGraph<int>::BuildOptions undirected;
+    undirected.undirected = true;
+    algo::GraphFile::convertEdgeList<int>(text, path, n, undirected);
+    auto tree = algo::GraphFile::load<int>(path);
+    algo::Lca lca(tree, 0, algo::Lca::Backend::EulerRmq);
+    algo::Lca reference(tree, 0);
+    for (int q = 0; q < 1000; q++) {
+        int u = rng() % n, v = rng() % n;
+        ASSERT_EQ(lca.lca(u, v), reference.lca(u, v));
+    }
+}
+
+TEST(GraphFileTest, RejectsBadFiles) {
+    const string path = tempPath("algo_graph_file_bad.bin");
+    algo::CsrGraph<int>::BuildOptions options;
+    options.undirected = true;
+    options.reverseEdges = true;
+    auto write = [&] { algo::GraphFile::write(path, algo::CsrGraph<int>(50, randomEdges<int>(50, 200, 5), options)); };
+
+    write();
+    EXPECT_THROW(algo::GraphFile::load<long long>(path), runtime_error);
+    EXPECT_THROW(algo::GraphFile::load<unsigned>(path), runtime_error);
+    EXPECT_THROW(algo::GraphFile::load<float>(path), runtime_error);
+    EXPECT_NO_THROW(algo::GraphFile::load<int>(path));
+
+    overwrite(path, 0, "X", 1);
+    EXPECT_THROW(algo::GraphFile::load<int>(path), runtime_error);
+
+    write();
+    uint32_t version = algo::GraphFile::kVersion + 1;
+    overwrite(path, 8, &version, sizeof(version));
+    EXPECT_THROW(algo::GraphFile::info(path), runtime_error);
+
+    // Target of arc 0 out of range: caught only when verifying.
+    write();
+    int bad = 50;
+    overwrite(path, 72 + 51 * 8, &bad, sizeof(bad));
+    EXPECT_THROW(algo::GraphFile::load<int>(path), runtime_error);
+    EXPECT_NO_THROW(algo::GraphFile::load<int>(path, false));
+
+    write();
+    filesystem::resize_file(path, filesystem::file_size(path) - 8);
+    EXPECT_THROW(algo::GraphFile::load<int>(path), runtime_error);
+
+    EXPECT_THROW(algo::GraphFile::load<int>(tempPath("algo_graph_file_missing.bin")), runtime_error);
+
+    ofstream(path) << "0 1\n1 x\n";
+    EXPECT_THROW(algo::GraphFile::convertEdgeList(path, tempPath("algo_graph_file_out.bin")), runtime_error);
+
+    // Vertex INT_MAX - 1 would need INT_MAX vertices, which the header rejects.
+    ofstream(path) << "0 2147483646\n";
+    EXPECT_THROW(algo::GraphFile::convertEdgeList(path, tempPath("algo_graph_file_out.bin")), out_of_range);
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Heavy-light decomposition of a rooted tree, for path and subtree
+    // queries on a segment tree.
+    //
+    // Vertices are laid out so that every heavy chain is a contiguous range
+    // of positions and every subtree is the range
+    // [position(v), position(v) + subtreeSize(v) - 1]. A path u..v crosses
+    // O(log n) chains, so it splits into O(log n) position ranges, and a
+    // path query or update on a segment tree costs O(log^2 n).
+    //
+    // The build is iterative: BFS for parents and depths, subtree sizes in
+    // reverse BFS order, then chain heads are taken from an explicit stack
+    // and each chain is numbered top-down before its light children.
+    //
+    // The tree input is the same as for Lca (vector adjacency or an
+    // undirected CsrGraph) and must be connected; a cycle or a repeated edge
+    // throws std::invalid_argument.
+    //
+    // The drivers below work with any segment tree over positions that has
+    // `value_type`, `OpT::merge` and `query(l, r)` (SingleUpdateSegmentTree
+    // or SegmentTree), plus `rangeAdd` / `rangeUpdate` for path and subtree
+    // updates (SegmentTree). Path queries merge chain results in no fixed
+    // order, so Op must be commutative (sum, max, min). Use layout() to
+    // turn per-vertex values into the initial array of the segment tree.
+    class HeavyLightDecomposition {
+    public:
+        template <typename Tree>
+        HeavyLightDecomposition(const Tree& tree, int root) : n_(static_cast<int>(tree.size())), root_(root) {
+            if (root < 0 || root >= n_) throw std::out_of_range("HeavyLightDecomposition: root out of range");
+            parent_.assign(n_, -1);
+            depth_.assign(n_, 0);
+            size_.assign(n_, 1);
+            heavy_.assign(n_, -1);
+            head_.assign(n_, 0);
+            pos_.assign(n_, 0);
+
+            std::vector<int> order;
+            order.reserve(n_);
+            order.push_back(root);
+            parent_[root] = root;
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                int u = order[i];
+                for (int v : neighbors(tree, u)) {
+                    if (v == parent_[u] || v == u) continue;
+                    if (parent_[v] != -1) throw std::invalid_argument("HeavyLightDecomposition: input has a cycle");
+                    parent_[v] = u;
+                    depth_[v] = depth_[u] + 1;
+                    order.push_back(v);
+                }
+            }
+            if (static_cast<int>(order.size()) != n_) {
+                throw std::invalid_argument("HeavyLightDecomposition: tree is not connected");
+            }
+            parent_[root] = -1;
+
+            for (int i = n_ - 1; i > 0; --i) {
+                int v = order[i], p = parent_[v];
+                size_[p] += size_[v];
+                if (heavy_[p] == -1 || size_[v] > size_[heavy_[p]]) heavy_[p] = v;
+            }
+
+            int next = 0;
+            std::vector<int> heads = {root};
+            while (!heads.empty()) {
+                int h = heads.back();
+                heads.pop_back();
+                for (int v = h; v != -1; v = heavy_[v]) {
+                    head_[v] = h;
+                    pos_[v] = next++;
+                    for (int c : neighbors(tree, v)) {
+                        if (c != parent_[v] && c != heavy_[v] && c != v) heads.push_back(c);
+                    }
+                }
+            }
+        }
+
+        int size() const { return n_; }
+        int root() const { return root_; }
+        int parent(int v) const { return parent_[v]; }
+        int depth(int v) const { return depth_[v]; }
+        int subtreeSize(int v) const { return size_[v]; }
+        int head(int v) const { return head_[v]; }
+        int position(int v) const { return pos_[v]; }
+
+        int lca(int u, int v) const {
+            while (head_[u] != head_[v]) {
+                if (depth_[head_[u]] < depth_[head_[v]]) std::swap(u, v);
+                u = parent_[head_[u]];
+            }
+            return depth_[u] < depth_[v] ? u : v;
+        }
+
+        int dist(int u, int v) const { return depth_[u] + depth_[v] - 2 * depth_[lca(u, v)]; }
+
+        // values[v] -> result[position(v)].
+        template <typename T>
+        std::vector<T> layout(const std::vector<T>& values) const {
+            std::vector<T> result(n_);
+            for (int v = 0; v < n_; ++v) result[pos_[v]] = values[v];
+            return result;
+        }
+
+        // Calls fn(l, r) for O(log n) inclusive position ranges covering the
+        // path u..v. Without the LCA, values kept on edges (stored at the
+        // child vertex) can be queried the same way.
+        template <typename F>
+        void forPath(int u, int v, F&& fn, bool includeLca = true) const {
+            while (head_[u] != head_[v]) {
+                if (depth_[head_[u]] < depth_[head_[v]]) std::swap(u, v);
+                fn(pos_[head_[u]], pos_[u]);
+                u = parent_[head_[u]];
+            }
+            if (depth_[u] > depth_[v]) std::swap(u, v);
+            int l = pos_[u] + (includeLca ? 0 : 1);
+            if (l <= pos_[v]) fn(l, pos_[v]);
+        }
+
+        std::pair<int, int> subtree(int v) const { return {pos_[v], pos_[v] + size_[v] - 1}; }
+
+        template <typename SegTree>
+        typename SegTree::value_type queryPath(SegTree& st, int u, int v, bool includeLca = true) const {
+            using Op = typename SegTree::OpT;
+            auto result = Op::identity();
+            forPath(u, v, [&](int l, int r) { result = Op::merge(result, st.query(l, r)); }, includeLca);
+            return result;
+        }
+
+        template <typename SegTree>
+        typename SegTree::value_type querySubtree(SegTree& st, int v) const {
+            return st.query(pos_[v], pos_[v] + size_[v] - 1);
+        }
+
+        template <typename SegTree, typename T>
+        void addPath(SegTree& st, int u, int v, const T& delta, bool includeLca = true) const {
+            forPath(u, v, [&](int l, int r) { st.rangeAdd(l, r, delta); }, includeLca);
+        }
+
+        template <typename SegTree, typename T>
+        void assignPath(SegTree& st, int u, int v, const T& value, bool includeLca = true) const {
+            forPath(u, v, [&](int l, int r) { st.rangeUpdate(l, r, value); }, includeLca);
+        }
+
+        template <typename SegTree, typename T>
+        void addSubtree(SegTree& st, int v, const T& delta) const {
+            st.rangeAdd(pos_[v], pos_[v] + size_[v] - 1, delta);
+        }
+
+        template <typename SegTree, typename T>
+        void assignSubtree(SegTree& st, int v, const T& value) const {
+            st.rangeUpdate(pos_[v], pos_[v] + size_[v] - 1, value);
+        }
+
+    private:
+        int n_, root_;
+        std::vector<int> parent_, depth_, size_, heavy_, head_, pos_;
+    };
+
+} // namespace algo
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "data_structure/single_update_segment_tree.hpp"
+#include "graph/heavy_light_decomposition.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// SingleUpdateSegmentTree defines its own SumOp / MaxOp, so it cannot share a
+// translation unit with bitwise_segment_tree.hpp.
+TEST(HeavyLightDecompositionTest, PointUpdatesWithSingleUpdateSegmentTree) {
+    for (unsigned seed = 1; seed <= 4; seed++) {
+        mt19937 rng(seed);
+        const int n = 200;
+        vector<vector<int>> adj(n);
+        vector<int> parent(n, -1), depth(n, 0);
+        for (int i = 1; i < n; i++) {
+            parent[i] = (int) (rng() % i);
+            depth[i] = depth[parent[i]] + 1;
+            adj[i].push_back(parent[i]);
+            adj[parent[i]].push_back(i);
+        }
+
+        vector<long long> value(n);
+        for (auto& x : value) x = rng() % 100;
+        algo::HeavyLightDecomposition hld(adj, 0);
+        algo::SingleUpdateSegmentTree<long long, algo::SumOp> sum(hld.layout(value));
+        algo::SingleUpdateSegmentTree<long long, algo::MaxOp> best(hld.layout(value));
+
+        for (int step = 0; step < 500; step++) {
+            int u = rng() % n, v = rng() % n;
+            if (step % 2 == 0) {
+                long long x = rng() % 100;
+                value[u] = x;
+                sum.update(hld.position(u), x);
+                best.update(hld.position(u), x);
+                continue;
+            }
+            long long s = 0, m = 0;
+            for (int a = u, b = v;;) {
+                if (depth[a] < depth[b]) swap(a, b);
+                s += value[a];
+                m = max(m, value[a]);
+                if (a == b) break;
+                a = parent[a];
+            }
+            ASSERT_EQ(hld.queryPath(sum, u, v), s);
+            ASSERT_EQ(hld.queryPath(best, u, v), m);
+
+            long long sub = 0;
+            for (int w = 0; w < n; w++) {
+                int a = w;
+                while (a != -1 && a != u) a = parent[a];
+                if (a == u) sub += value[w];
+            }
+            ASSERT_EQ(hld.querySubtree(sum, u), sub);
+        }
+    }
+}
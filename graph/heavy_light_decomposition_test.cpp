@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "data_structure/bitwise_segment_tree.hpp"
+#include "graph/heavy_light_decomposition.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    vector<vector<int>> randomTree(int n, unsigned seed, vector<int>& parent) {
+        mt19937 rng(seed);
+        vector<vector<int>> adj(n);
+        parent.assign(n, -1);
+        for (int i = 1; i < n; i++) {
+            parent[i] = seed % 2 ? (int) (rng() % i) : max(0, i - 1 - (int) (rng() % 2));
+            adj[i].push_back(parent[i]);
+            adj[parent[i]].push_back(i);
+        }
+        return adj;
+    }
+
+    vector<int> naivePath(const vector<int>& parent, const vector<int>& depth, int u, int v) {
+        vector<int> path;
+        while (u != v) {
+            if (depth[u] < depth[v]) swap(u, v);
+            path.push_back(u);
+            u = parent[u];
+        }
+        path.push_back(u);
+        return path;
+    }
+
+    bool inSubtree(const vector<int>& parent, int v, int root) {
+        for (; v != -1; v = parent[v]) {
+            if (v == root) return true;
+        }
+        return false;
+    }
+}
+
+TEST(HeavyLightDecompositionTest, LayoutInvariants) {
+    vector<int> parent;
+    auto adj = randomTree(500, 3, parent);
+    algo::HeavyLightDecomposition hld(adj, 0);
+    vector<int> seen(500, 0);
+    for (int v = 0; v < 500; v++) {
+        seen[hld.position(v)]++;
+        EXPECT_EQ(hld.parent(v), parent[v]);
+        auto [l, r] = hld.subtree(v);
+        EXPECT_EQ(r - l + 1, hld.subtreeSize(v));
+        // Chains are contiguous and start at their head.
+        if (hld.head(v) != v) {
+            EXPECT_EQ(hld.position(v), hld.position(parent[v]) + 1);
+        }
+    }
+    EXPECT_EQ(count(seen.begin(), seen.end(), 1), 500);
+}
+
+TEST(HeavyLightDecompositionTest, PathAndSubtreeOperationsMatchNaive) {
+    for (unsigned seed = 1; seed <= 8; seed++) {
+        mt19937 rng(seed);
+        int n = 50 + seed * 60;
+        vector<int> parent;
+        auto adj = randomTree(n, seed, parent);
+        vector<int> depth(n, 0);
+        for (int i = 1; i < n; i++) depth[i] = depth[parent[i]] + 1;
+
+        vector<long long> value(n);
+        for (auto& x : value) x = rng() % 100;
+        algo::HeavyLightDecomposition hld(adj, 0);
+        algo::SegmentTree<long long, algo::SumOp> sum(hld.layout(value));
+        algo::SegmentTree<long long, algo::MaxOp> best(hld.layout(value));
+
+        for (int step = 0; step < 400; step++) {
+            int u = rng() % n, v = rng() % n;
+            long long x = (long long) (rng() % 50) - 10;
+            auto path = naivePath(parent, depth, u, v);
+            ASSERT_EQ(hld.lca(u, v), path.back());
+            switch (rng() % 5) {
+            case 0:
+                hld.addPath(sum, u, v, x);
+                hld.addPath(best, u, v, x);
+                for (int w : path) value[w] += x;
+                break;
+            case 1:
+                hld.assignPath(sum, u, v, x);
+                hld.assignPath(best, u, v, x);
+                for (int w : path) value[w] = x;
+                break;
+            case 2:
+                hld.addSubtree(sum, u, x);
+                hld.addSubtree(best, u, x);
+                for (int w = 0; w < n; w++) {
+                    if (inSubtree(parent, w, u)) value[w] += x;
+                }
+                break;
+            case 3: {
+                long long s = 0, m = LLONG_MIN, e = 0;
+                for (int w : path) {
+                    s += value[w];
+                    m = max(m, value[w]);
+                    if (w != path.back()) e += value[w];
+                }
+                ASSERT_EQ(hld.queryPath(sum, u, v), s);
+                ASSERT_EQ(hld.queryPath(best, u, v), m);
+                ASSERT_EQ(hld.queryPath(sum, u, v, false), e);
+                break;
+            }
+            default: {
+                long long s = 0;
+                for (int w = 0; w < n; w++) {
+                    if (inSubtree(parent, w, u)) s += value[w];
+                }
+                ASSERT_EQ(hld.querySubtree(sum, u), s);
+                break;
+            }
+            }
+        }
+        EXPECT_EQ(hld.dist(0, n - 1), depth[n - 1]);
+    }
+}
+
+TEST(HeavyLightDecompositionTest, DeepCsrTree) {
+    const int n = 300000;
+    vector<algo::CsrGraph<int>::Edge> edges;
+    for (int i = 1; i < n; i++) edges.push_back({i - 1, i, 1});
+    algo::CsrGraph<int> g(n, edges, {.undirected = true});
+    algo::HeavyLightDecomposition hld(g, n - 1);
+    EXPECT_EQ(hld.lca(0, 5), 5);
+    EXPECT_EQ(hld.depth(0), n - 1);
+    int ranges = 0;
+    hld.forPath(0, n - 1, [&](int l, int r) {
+        ranges++;
+        EXPECT_EQ(r - l + 1, n);
+    });
+    EXPECT_EQ(ranges, 1);
+}
+
+TEST(HeavyLightDecompositionTest, InvalidInput) {
+    vector<vector<int>> forest = {{1}, {0}, {}};
+    EXPECT_THROW(algo::HeavyLightDecomposition(forest, 0), std::invalid_argument);
+    EXPECT_THROW(algo::HeavyLightDecomposition(forest, 3), std::out_of_range);
+    vector<vector<int>> triangle = {{1, 2}, {0, 2}, {0, 1}};
+    EXPECT_THROW(algo::HeavyLightDecomposition(triangle, 0), std::invalid_argument);
+    vector<vector<int>> repeated = {{1, 1}, {0, 0}};
+    EXPECT_THROW(algo::HeavyLightDecomposition(repeated, 0), std::invalid_argument);
+}
@@ -3,6 +3,8 @@
 #include <string>
 #include <algorithm>
 
+#include "graph/csr_graph.hpp"
+
 using namespace std;
 
 template <typename T>
@@ -16,6 +18,16 @@ public:
 		father.resize(n);
 		for (int i = 0; i < n; i++) father[i] = i;
 	}
+
+	// Expects a CSR graph built with undirected = true and keeps only the
+	// u < v copy of each edge. algo::MinimumSpanningTree is the faster choice
+	// for large graphs.
+	Kruskal(const algo::CsrGraph<T> &g) : Kruskal(g.size()) {
+		edges.reserve(g.edgeCount() / 2);
+		for (int u = 0; u < n; u++)
+			for (auto [v, w] : g[u])
+				if (u < v) add_edge(u, v, w);
+	}
 	void add_edge(int u, int v, T value) {
 		index_sanity_check(u, "add_edge");
 		index_sanity_check(v, "add_edge");
@@ -2,72 +2,383 @@
 
 #include <vector>
 #include <algorithm>
-#include <queue>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+#include "graph/csr_graph.hpp"
 
 namespace algo {
+    // Lowest common ancestor, with two interchangeable backends:
+    //
+    //   BinaryLifting : 2^i-th ancestors, O(n log h) memory for height h,
+    //                   O(log h) per query.
+    //   EulerRmq      : preorder of the tree; for tin[u] < tin[v] the LCA is
+    //                   the vertex with the smallest preorder index among the
+    //                   parents of the vertices at positions tin[u]+1..tin[v].
+    //                   That range minimum is answered in O(1) with 64-wide
+    //                   blocks: a monotonic-stack bitmask per position for
+    //                   in-block ranges and a sparse table over block minima,
+    //                   about 2n words of memory in total.
+    //
+    // Vertices are relabelled in BFS order, so parents have smaller labels
+    // than their children and the vertices of one level are adjacent. All
+    // tables are int32 arrays indexed by label; the jump table is
+    // level-major (level k of every vertex, then level k + 1), and level 0
+    // is the parent array, which both backends keep.
+    //
+    // kthAncestor() uses the ladder algorithm: the tree is cut into longest
+    // paths, each extended upwards by its own length into a ladder. With
+    // BinaryLifting one jump of 2^floor(log k) lands on a vertex whose
+    // ladder covers the rest, O(1); with EulerRmq it climbs ladders,
+    // O(log n).
+    //
+    // Input is vector adjacency, a CsrGraph (undirected, or children only)
+    // or a parent array (fromParents()), which never builds adjacency lists.
+    // Everything is built without recursion; stats() reports the build
+    // time and memory.
     class Lca {
     public:
-        explicit Lca(const std::vector<std::vector<int>>& tree, int root) {
-            this->root = root;
-            this->n = tree.size();
-            this->max_log = 32 - __builtin_clz(n);
-            this->up.assign(n, std::vector<int>(max_log));
-            this->depth.resize(n);
-            bfs(root, tree);
+        enum class Backend { BinaryLifting, EulerRmq };
+
+        struct BuildStats {
+            double seconds = 0;
+            std::size_t bytes = 0;     // held after the build
+            std::size_t peakBytes = 0; // including build scratch
+        };
+
+        // Tree: std::vector<std::vector<int>> adjacency or a CsrGraph. Every
+        // vertex must be reachable from root; a cycle or a repeated edge
+        // throws std::invalid_argument.
+        template <typename Tree>
+        explicit Lca(const Tree& tree, int root, Backend backend = Backend::BinaryLifting) {
+            build(tree, root, backend);
+        }
+
+        // parent[v] is the parent of v, -1 for the single root.
+        static Lca fromParents(const std::vector<int>& parent, Backend backend = Backend::BinaryLifting) {
+            auto start = std::chrono::steady_clock::now();
+            Children children;
+            const int n = static_cast<int>(parent.size());
+            children.offsets.assign(n + 1, 0);
+            int root = -1;
+            for (int v = 0; v < n; v++) {
+                int p = parent[v];
+                if (p < -1 || p >= n) throw std::invalid_argument("Lca: parent out of range");
+                if (p == -1) {
+                    if (root != -1) throw std::invalid_argument("Lca: more than one root");
+                    root = v;
+                } else {
+                    children.offsets[p + 1]++;
+                }
+            }
+            if (root == -1) throw std::invalid_argument("Lca: no root");
+            for (int v = 0; v < n; v++) children.offsets[v + 1] += children.offsets[v];
+            children.targets.resize(n - 1);
+            std::vector<int> cursor(children.offsets.begin(), children.offsets.end() - 1);
+            for (int v = 0; v < n; v++) {
+                if (parent[v] != -1) children.targets[cursor[parent[v]]++] = v;
+            }
+            std::size_t scratch = bytesOf(children.offsets) + bytesOf(children.targets) + bytesOf(cursor);
+            cursor = {};
+
+            Lca result(children, root, backend);
+            result.stats_.peakBytes += scratch;
+            result.stats_.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            return result;
         }
 
+        Backend backend() const { return mode; }
+        int size() const { return n; }
+        const BuildStats& stats() const { return stats_; }
+
+        int depth(int v) const { return depths[label[v]]; }
+
         int lca(int u, int v) const {
-            if (depth[u] > depth[v]) {
+            int a = label[u], b = label[v];
+            return vertex[mode == Backend::EulerRmq ? rmqLca(a, b) : liftingLca(a, b)];
+        }
+
+        int dist(int u, int v) const {
+            int a = label[u], b = label[v];
+            int c = mode == Backend::EulerRmq ? rmqLca(a, b) : liftingLca(a, b);
+            return depths[a] + depths[b] - 2 * depths[c];
+        }
+
+        // Ancestor k levels above v (v itself for k = 0), -1 if k > depth(v).
+        int kthAncestor(int v, int k) const {
+            int a = label[v];
+            if (k < 0 || k > depths[a]) return -1;
+            if (k == 0) return v;
+            if (mode == Backend::BinaryLifting) {
+                int h = std::bit_width(static_cast<unsigned>(k)) - 1;
+                a = jump(a, h);
+                k -= 1 << h;
+            }
+            for (;;) {
+                int p = path[a];
+                int target = depths[a] - k;
+                if (target >= ladder_top_depth[p]) {
+                    return vertex[ladder[ladder_start[p] + target - ladder_top_depth[p]]];
+                }
+                k -= depths[a] - ladder_top_depth[p];
+                a = ladder[ladder_start[p]];
+            }
+        }
+
+        // Ancestor of v at depth d, -1 if d is not in [0, depth(v)].
+        int levelAncestor(int v, int d) const {
+            return d < 0 ? -1 : kthAncestor(v, depth(v) - d);
+        }
+    private:
+        static constexpr int kBlock = 64;
+
+        // Children-only CSR built by fromParents().
+        struct Children {
+            std::vector<int> offsets, targets;
+
+            int size() const { return static_cast<int>(offsets.size()) - 1; }
+
+            friend std::span<const int> neighbors(const Children& c, int u) {
+                return {c.targets.data() + c.offsets[u], static_cast<std::size_t>(c.offsets[u + 1] - c.offsets[u])};
+            }
+        };
+
+        template <typename T>
+        static std::size_t bytesOf(const std::vector<T>& v) {
+            return v.capacity() * sizeof(T);
+        }
+
+        std::size_t heldBytes() const {
+            return bytesOf(label) + bytesOf(vertex) + bytesOf(depths) + bytesOf(up) + bytesOf(tin) + bytesOf(order) +
+                   bytesOf(value) + bytesOf(table) + bytesOf(mask) + bytesOf(path) + bytesOf(ladder) +
+                   bytesOf(ladder_start) + bytesOf(ladder_top_depth);
+        }
+
+        int liftingLca(int u, int v) const {
+            if (depths[u] > depths[v]) {
                 std::swap(u, v);
             }
             for (int i = max_log - 1; i >= 0; i--) {
-                if (depth[v] - depth[u] >= (1 << i)) {
-                    v = up[v][i];
+                if (depths[v] - depths[u] >= (1 << i)) {
+                    v = jump(v, i);
                 }
             }
             if (u == v) {
                 return u;
             }
             for (int i = max_log - 1; i >= 0; i--) {
-                if (up[u][i] != up[v][i]) {
-                    u = up[u][i];
-                    v = up[v][i];
+                if (jump(u, i) != jump(v, i)) {
+                    u = jump(u, i);
+                    v = jump(v, i);
                 }
             }
-            return up[u][0];
+            return jump(u, 0);
         }
 
-        int dist(int u, int v) const {
-            return depth[u] + depth[v] - 2 * depth[lca(u, v)];
+        int jump(int v, int i) const {
+            return up[static_cast<std::size_t>(i) * n + v];
+        }
+
+        int rmqLca(int u, int v) const {
+            if (u == v) {
+                return u;
+            }
+            int l = tin[u], r = tin[v];
+            if (l > r) {
+                std::swap(l, r);
+            }
+            return order[rangeMin(l + 1, r)];
+        }
+
+        int rangeMin(int l, int r) const {
+            int bl = l / kBlock, br = r / kBlock;
+            if (bl == br) {
+                return inBlock(l, r);
+            }
+            int best = std::min(inBlock(l, bl * kBlock + kBlock - 1), inBlock(br * kBlock, r));
+            if (bl + 1 < br) {
+                int k = std::bit_width(static_cast<unsigned>(br - bl - 1)) - 1;
+                best = std::min({best, table[k * blocks + bl + 1], table[k * blocks + br - (1 << k)]});
+            }
+            return best;
         }
-    private:
-        void bfs(int root, const std::vector<std::vector<int>>& tree) {
-            std::queue<int> q;
-            q.push(root);
 
-            depth[root] = 0;
-            up[root][0] = root; 
+        // Minimum of value[l..r] inside one block: the lowest stack entry at or after l.
+        int inBlock(int l, int r) const {
+            std::uint64_t m = mask[r] & (~std::uint64_t(0) << (l % kBlock));
+            return value[r - r % kBlock + std::countr_zero(m)];
+        }
+
+        template <typename Tree>
+        void build(const Tree& tree, int root, Backend backend) {
+            auto start = std::chrono::steady_clock::now();
+            this->root = root;
+            this->n = static_cast<int>(tree.size());
+            this->mode = backend;
+            if (root < 0 || root >= n) throw std::out_of_range("Lca: root out of range");
 
-            while (!q.empty()) {
-                int u = q.front();
-                q.pop();
+            // BFS relabel; parents go straight into level 0 of the jump table.
+            label.assign(n, -1);
+            vertex.resize(n);
+            up.resize(n);
+            vertex[0] = root;
+            label[root] = 0;
+            up[0] = 0;
+            int tail = 1;
+            for (int i = 0; i < tail; i++) {
+                for (int v : neighbors(tree, vertex[i])) {
+                    if (label[v] != -1) {
+                        if (label[v] == up[i] || label[v] == i) {
+                            continue;
+                        }
+                        throw std::invalid_argument("Lca: input has a cycle");
+                    }
+                    label[v] = tail;
+                    vertex[tail] = v;
+                    up[tail] = i;
+                    tail++;
+                }
+            }
+            if (tail != n) throw std::invalid_argument("Lca: tree is not connected");
+
+            depths.assign(n, 0);
+            int height = 0;
+            for (int i = 1; i < n; i++) {
+                depths[i] = depths[up[i]] + 1;
+                height = std::max(height, depths[i]);
+            }
+
+            std::size_t scratch = 0;
+            if (backend == Backend::BinaryLifting) {
+                max_log = std::max(1, static_cast<int>(std::bit_width(static_cast<unsigned>(height))));
+                up.resize(static_cast<std::size_t>(max_log) * n);
+                for (int k = 1; k < max_log; k++) {
+                    const int* prev = &up[static_cast<std::size_t>(k - 1) * n];
+                    int* cur = &up[static_cast<std::size_t>(k) * n];
+                    for (int i = 0; i < n; i++) {
+                        cur[i] = prev[prev[i]];
+                    }
+                }
+            } else {
+                max_log = 1;
+                scratch = preorder(tree);
+                buildRmq();
+            }
+            scratch = std::max(scratch, buildLadders());
+            stats_.bytes = heldBytes();
+            stats_.peakBytes = stats_.bytes + scratch;
+            stats_.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
 
-                for (int i = 1; i < max_log; i++) {
-                    up[u][i] = up[up[u][i - 1]][i - 1];
+        // Iterative preorder over labels; value[i] = preorder index of the
+        // parent of order[i]. Returns the scratch bytes used.
+        template <typename Tree>
+        std::size_t preorder(const Tree& tree) {
+            tin.assign(n, 0);
+            order.clear();
+            order.reserve(n);
+            value.assign(n, 0);
+            std::vector<int> stack = {0};
+            std::size_t peak = 0;
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                tin[u] = static_cast<int>(order.size());
+                value[tin[u]] = tin[up[u]];
+                order.push_back(u);
+                for (int v : neighbors(tree, vertex[u])) {
+                    if (label[v] != u && up[label[v]] == u) {
+                        stack.push_back(label[v]);
+                    }
                 }
+                peak = std::max(peak, stack.capacity());
+            }
+            return peak * sizeof(int);
+        }
 
-                for (int v : tree[u]) {
-                    if (v != up[u][0]) {
-                        depth[v] = depth[u] + 1;
-                        up[v][0] = u;
-                        q.push(v);
+        void buildRmq() {
+            const int size = static_cast<int>(order.size());
+            mask.assign(size, 0);
+            for (int start = 0; start < size; start += kBlock) {
+                std::uint64_t stack = 0;
+                for (int i = start; i < std::min(size, start + kBlock); i++) {
+                    while (stack != 0 && value[start + 63 - std::countl_zero(stack)] >= value[i]) {
+                        stack ^= std::uint64_t(1) << (63 - std::countl_zero(stack));
                     }
+                    stack |= std::uint64_t(1) << (i - start);
+                    mask[i] = stack;
+                }
+            }
+
+            blocks = (size + kBlock - 1) / kBlock;
+            int levels = std::max(1, static_cast<int>(std::bit_width(static_cast<unsigned>(blocks))));
+            table.assign(static_cast<std::size_t>(levels) * blocks, 0);
+            for (int b = 0; b < blocks; b++) {
+                table[b] = *std::min_element(value.begin() + b * kBlock, value.begin() + std::min(size, (b + 1) * kBlock));
+            }
+            for (int k = 1; k < levels; k++) {
+                for (int b = 0; b + (1 << k) <= blocks; b++) {
+                    table[k * blocks + b] = std::min(table[(k - 1) * blocks + b], table[(k - 1) * blocks + b + (1 << (k - 1))]);
                 }
             }
         }
 
-        int root, n, max_log;
-        std::vector<std::vector<int>> up;
-        std::vector<int> depth;
+        // Longest-path decomposition and ladders, O(n). Returns the scratch
+        // bytes used.
+        std::size_t buildLadders() {
+            std::vector<int> below(n, 0), tall(n, -1);
+            for (int i = n - 1; i > 0; i--) {
+                int p = up[i];
+                if (tall[p] == -1 || below[i] + 1 > below[p]) {
+                    below[p] = below[i] + 1;
+                    tall[p] = i;
+                }
+            }
+
+            path.assign(n, 0);
+            ladder.clear();
+            ladder.reserve(2 * static_cast<std::size_t>(n));
+            ladder_start.clear();
+            ladder_top_depth.clear();
+            for (int i = 0; i < n; i++) {
+                if (i != 0 && tall[up[i]] == i) {
+                    continue;
+                }
+                int length = below[i] + 1;
+                int extension = std::min(length, depths[i]);
+                int p = static_cast<int>(ladder_start.size());
+                int start = static_cast<int>(ladder.size());
+                ladder_start.push_back(start);
+                ladder_top_depth.push_back(depths[i] - extension);
+                ladder.resize(ladder.size() + extension + length);
+                for (int j = extension - 1, x = i; j >= 0; j--) {
+                    x = up[x];
+                    ladder[start + j] = x;
+                }
+                for (int j = 0, y = i; j < length; j++, y = tall[y]) {
+                    ladder[start + extension + j] = y;
+                    path[y] = p;
+                }
+            }
+            return bytesOf(below) + bytesOf(tall);
+        }
+
+        int root = 0, n = 0, max_log = 1;
+        Backend mode = Backend::BinaryLifting;
+        BuildStats stats_;
+        std::vector<int> label, vertex; // vertex <-> BFS label
+        std::vector<int> depths;        // by label
+        std::vector<int> up;            // level-major, level 0 = parent
+
+        // EulerRmq backend.
+        int blocks = 0;
+        std::vector<int> tin, order, value, table;
+        std::vector<std::uint64_t> mask;
+
+        // Ladders for kthAncestor.
+        std::vector<int> path, ladder, ladder_start, ladder_top_depth;
     };
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "graph/lca.hpp"
+#include <algorithm>
+#include <random>
 #include <vector>
 
 using namespace std;
@@ -85,3 +87,148 @@ TEST(LCATest, StarGraph) {
     EXPECT_EQ(lca_solver.lca(2, 3), 0);
     EXPECT_EQ(lca_solver.lca(0, 1), 0);
 }
+
+namespace {
+    // Random tree: parent of i is a random earlier vertex, or i - 1 with a
+    // long tail when `deep` is set.
+    vector<vector<int>> random_tree(int n, bool deep, unsigned seed, vector<int>& parent) {
+        mt19937 rng(seed);
+        vector<vector<int>> adj(n);
+        parent.assign(n, -1);
+        for (int i = 1; i < n; i++) {
+            parent[i] = deep && rng() % 4 != 0 ? i - 1 : (int) (rng() % i);
+            adj[i].push_back(parent[i]);
+            adj[parent[i]].push_back(i);
+        }
+        return adj;
+    }
+
+    int naive_lca(const vector<int>& parent, const vector<int>& depth, int u, int v) {
+        while (depth[u] > depth[v]) u = parent[u];
+        while (depth[v] > depth[u]) v = parent[v];
+        while (u != v) {
+            u = parent[u];
+            v = parent[v];
+        }
+        return u;
+    }
+}
+
+TEST(LCATest, BackendsMatchNaive) {
+    for (unsigned seed = 1; seed <= 12; seed++) {
+        int n = 1 + seed * 157;
+        vector<int> parent;
+        auto adj = random_tree(n, seed % 2 == 0, seed, parent);
+        vector<int> depth(n, 0);
+        for (int i = 1; i < n; i++) depth[i] = depth[parent[i]] + 1;
+
+        algo::Lca lifting(adj, 0);
+        algo::Lca euler(adj, 0, algo::Lca::Backend::EulerRmq);
+        EXPECT_EQ(lifting.backend(), algo::Lca::Backend::BinaryLifting);
+        EXPECT_EQ(euler.backend(), algo::Lca::Backend::EulerRmq);
+        mt19937 rng(seed);
+        for (int q = 0; q < 2000; q++) {
+            int u = rng() % n, v = rng() % n;
+            int expected = naive_lca(parent, depth, u, v);
+            ASSERT_EQ(lifting.lca(u, v), expected);
+            ASSERT_EQ(euler.lca(u, v), expected);
+            ASSERT_EQ(euler.dist(u, v), depth[u] + depth[v] - 2 * depth[expected]);
+        }
+    }
+}
+
+TEST(LCATest, EulerRmqOnCsrAndDeepTree) {
+    // Deep enough to overflow a recursive DFS.
+    const int n = 300000;
+    vector<algo::CsrGraph<int>::Edge> edges;
+    for (int i = 1; i < n; i++) edges.push_back({i - 1, i, 1});
+    algo::CsrGraph<int> g(n, edges, {.undirected = true});
+    algo::Lca euler(g, n / 2, algo::Lca::Backend::EulerRmq);
+    algo::Lca lifting(g, n / 2);
+    EXPECT_EQ(euler.lca(0, n - 1), n / 2);
+    EXPECT_EQ(euler.lca(0, 10), 10);
+    EXPECT_EQ(euler.lca(n - 1, n - 7), n - 7);
+    EXPECT_EQ(euler.dist(0, n - 1), n - 1);
+    EXPECT_EQ(lifting.lca(0, n - 1), n / 2);
+    EXPECT_EQ(lifting.dist(3, n - 2), n - 5);
+}
+
+TEST(LCATest, FromParentsAndKthAncestor) {
+    for (unsigned seed = 1; seed <= 8; seed++) {
+        mt19937 rng(seed);
+        int n = 100 + seed * 500;
+        // Shuffled ids so that the BFS relabel is not the identity.
+        vector<int> perm(n);
+        for (int i = 0; i < n; i++) perm[i] = i;
+        shuffle(perm.begin(), perm.end(), rng);
+        vector<int> parent;
+        random_tree(n, seed % 2 == 0, seed, parent);
+        vector<int> shuffled(n, -1), depth(n, 0);
+        for (int i = 1; i < n; i++) {
+            shuffled[perm[i]] = perm[parent[i]];
+            depth[perm[i]] = depth[perm[parent[i]]] + 1;
+        }
+
+        for (auto backend : {algo::Lca::Backend::BinaryLifting, algo::Lca::Backend::EulerRmq}) {
+            auto lca = algo::Lca::fromParents(shuffled, backend);
+            EXPECT_EQ(lca.size(), n);
+            EXPECT_GT(lca.stats().bytes, 0u);
+            EXPECT_GE(lca.stats().peakBytes, lca.stats().bytes);
+            for (int q = 0; q < 1000; q++) {
+                int u = rng() % n, v = rng() % n;
+                ASSERT_EQ(lca.lca(u, v), naive_lca(shuffled, depth, u, v));
+                ASSERT_EQ(lca.depth(u), depth[u]);
+
+                int k = rng() % (depth[u] + 2);
+                int expected = u;
+                for (int i = 0; i < k && expected != -1; i++) expected = shuffled[expected];
+                ASSERT_EQ(lca.kthAncestor(u, k), expected) << "k " << k;
+                if (expected != -1) {
+                    ASSERT_EQ(lca.levelAncestor(u, depth[u] - k), expected);
+                }
+            }
+            EXPECT_EQ(lca.kthAncestor(perm[0], 0), perm[0]);
+            EXPECT_EQ(lca.kthAncestor(perm[0], 1), -1);
+            EXPECT_EQ(lca.kthAncestor(perm[n - 1], -1), -1);
+        }
+    }
+}
+
+TEST(LCATest, KthAncestorOnDeepPath) {
+    const int n = 200000;
+    vector<int> parent(n);
+    for (int i = 0; i < n; i++) parent[i] = i - 1;
+    auto lifting = algo::Lca::fromParents(parent);
+    auto euler = algo::Lca::fromParents(parent, algo::Lca::Backend::EulerRmq);
+    for (int k : {0, 1, 2, 63, 64, 65, 1000, 65535, 65536, n - 1}) {
+        EXPECT_EQ(lifting.kthAncestor(n - 1, k), n - 1 - k);
+        EXPECT_EQ(euler.kthAncestor(n - 1, k), n - 1 - k);
+    }
+    EXPECT_EQ(euler.lca(n - 1, 17), 17);
+    EXPECT_EQ(lifting.dist(3, n - 1), n - 4);
+}
+
+TEST(LCATest, InvalidTrees) {
+    EXPECT_THROW(algo::Lca::fromParents({-1, 0, -1}), std::invalid_argument);
+    EXPECT_THROW(algo::Lca::fromParents({1, 2, 0}), std::invalid_argument);
+    EXPECT_THROW(algo::Lca::fromParents({-1, 0, 3, 2}), std::invalid_argument);
+    EXPECT_THROW(algo::Lca::fromParents({-1, 5}), std::invalid_argument);
+    vector<vector<int>> forest = {{1}, {0}, {}};
+    EXPECT_THROW(algo::Lca(forest, 0), std::invalid_argument);
+    EXPECT_THROW(algo::Lca(forest, 3), std::out_of_range);
+
+    vector<vector<int>> cycle = {{1, 2}, {0, 3}, {0, 3}, {1, 2}};
+    vector<vector<int>> repeated = {{1, 1}, {0, 0, 2}, {1}};
+    for (auto backend : {algo::Lca::Backend::BinaryLifting, algo::Lca::Backend::EulerRmq}) {
+        EXPECT_THROW(algo::Lca(cycle, 0, backend), std::invalid_argument);
+        EXPECT_THROW(algo::Lca(cycle, 3, backend), std::invalid_argument);
+        EXPECT_THROW(algo::Lca(repeated, 0, backend), std::invalid_argument);
+    }
+    // Self-loops are not tree edges and are skipped.
+    vector<vector<int>> loops = {{0, 1}, {0, 1, 2}, {1}};
+    for (auto backend : {algo::Lca::Backend::BinaryLifting, algo::Lca::Backend::EulerRmq}) {
+        algo::Lca lca(loops, 0, backend);
+        EXPECT_EQ(lca.lca(2, 0), 0);
+        EXPECT_EQ(lca.dist(2, 0), 2);
+    }
+}
@@ -0,0 +1,491 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Maximum flow with 64-bit capacities, two engines over one network.
+    //
+    //   dinic(s, t) : Dinic with current-arc pointers. Blocking flows are
+    //                 found by an explicit-stack DFS, so long augmenting paths
+    //                 cannot overflow the call stack. O(n^2 m).
+    //   hlpp(s, t)  : highest-label push-relabel with the gap heuristic and
+    //                 periodic global relabeling (reverse BFS from t).
+    //                 O(n^2 sqrt(m)).
+    //
+    // hlpp() runs the first phase only: it stops once no vertex that can
+    // still reach t has excess. The returned value is the maximum flow, but
+    // flow(e) afterwards describes a preflow; excess left on vertices that
+    // cannot reach t is not returned to s. Use dinic() when a valid flow
+    // decomposition is needed.
+    //
+    // Edge e is stored as arcs 2e (forward) and 2e + 1 (residual), so the
+    // reverse of arc a is a ^ 1. Before solving, arcs are reordered into a
+    // CSR layout (arcs of a vertex contiguous, each with the CSR position of
+    // its reverse), so scanning a vertex is a sequential read. Every solve
+    // starts from zero flow.
+    //
+    // After a solve, minCut() returns a minimum s-t cut. After dinic(),
+    // updateCapacity(e, c) changes one capacity and repairs the existing
+    // flow locally instead of solving again:
+    //   increase : the residual grows, then s -> t is re-augmented.
+    //   decrease : only when c drops below flow(e). The surplus left at
+    //              from(e) is first rerouted to to(e) around e; what cannot
+    //              be rerouted is returned to s (flow into from(e) is
+    //              cancelled) and taken back from t (flow out of to(e) is
+    //              cancelled); then s -> t is re-augmented.
+    // Adding edges ends incremental mode; edges that may change later can be
+    // added up front with capacity 0.
+    class MaxFlow {
+    public:
+        using Capacity = long long;
+        // Edge e owns arc ids 2e and 2e + 1, which must fit in an int.
+        static constexpr int kMaxEdges = std::numeric_limits<int>::max() / 2;
+
+        struct Cut {
+            std::vector<int> sourceSide; // ascending vertex ids, contains s
+            std::vector<int> edges;      // ids of positive-capacity edges leaving sourceSide
+            Capacity capacity = 0;
+        };
+
+        explicit MaxFlow(int n = 0) : n_(n) {
+            if (n < 0) throw std::invalid_argument("MaxFlow: negative vertex count");
+        }
+
+        // One edge per arc of g with capacity weight(e), so edge ids are the
+        // arc indices of g. Build g without reverseEdges: the residual arcs
+        // are added here. Throws std::length_error for more than kMaxEdges
+        // arcs and std::invalid_argument for a weight outside [0, 2^63).
+        template <typename W>
+        explicit MaxFlow(const CsrGraph<W>& g) : MaxFlow(g.size()) {
+            static_assert(std::is_integral_v<W>, "MaxFlow: capacities must be integers");
+            if (g.edgeCount() > kMaxEdges) {
+                throw std::length_error("MaxFlow: " + std::to_string(g.edgeCount()) + " arcs, at most " +
+                                        std::to_string(kMaxEdges) + " are supported");
+            }
+            reserve(static_cast<int>(g.edgeCount()));
+            for (int u = 0; u < g.size(); ++u) {
+                for (long long e = g.begin(u); e < g.end(u); ++e) {
+                    const W w = g.weight(e);
+                    if constexpr (std::is_unsigned_v<W> && sizeof(W) >= sizeof(Capacity)) {
+                        if (w > static_cast<W>(std::numeric_limits<Capacity>::max())) {
+                            throw std::invalid_argument("MaxFlow: capacity " + std::to_string(w) + " does not fit");
+                        }
+                    }
+                    addEdge(u, g.target(e), static_cast<Capacity>(w));
+                }
+            }
+        }
+
+        int size() const { return n_; }
+        int edgeCount() const { return static_cast<int>(cap_.size()); }
+
+        void reserve(int edges) {
+            from_.reserve(edges);
+            to_.reserve(edges);
+            cap_.reserve(edges);
+        }
+
+        // Returns the id of the new edge; ids are 0, 1, 2, ... in insertion order.
+        int addEdge(int from, int to, Capacity capacity) {
+            if (from < 0 || from >= n_ || to < 0 || to >= n_) {
+                throw std::out_of_range("MaxFlow: edge (" + std::to_string(from) + ", " + std::to_string(to) +
+                                        ") out of range");
+            }
+            if (capacity < 0) throw std::invalid_argument("MaxFlow: negative capacity");
+            if (cap_.size() >= static_cast<std::size_t>(kMaxEdges)) throw std::length_error("MaxFlow: too many edges");
+            from_.push_back(from);
+            to_.push_back(to);
+            cap_.push_back(capacity);
+            state_ = State::None;
+            return static_cast<int>(cap_.size()) - 1;
+        }
+
+        int from(int e) const { return from_[e]; }
+        int to(int e) const { return to_[e]; }
+        Capacity capacity(int e) const { return cap_[e]; }
+
+        // Flow on edge e after the last solve (see the preflow note for hlpp).
+        Capacity flow(int e) const {
+            if (static_cast<std::size_t>(2 * e) >= pos_.size()) return 0;
+            return cap_[e] - res_[pos_[2 * e]];
+        }
+
+        // Value of the last solve, kept up to date by updateCapacity().
+        Capacity value() const { return value_; }
+
+        Capacity dinic(int s, int t) {
+            prepare(s, t);
+            value_ = augment(s, t, kUnlimited);
+            state_ = State::Flow;
+            return value_;
+        }
+
+        Capacity hlpp(int s, int t) {
+            prepare(s, t);
+            height_.assign(n_, 0);
+            excess_.assign(n_, 0);
+            activeHead_.assign(n_ + 1, -1);
+            activeNext_.assign(n_, -1);
+            allHead_.assign(n_ + 1, -1);
+            allNext_.assign(n_, -1);
+            allPrev_.assign(n_, -1);
+
+            for (long long p = offsets_[s]; p < offsets_[s + 1]; ++p) {
+                Capacity d = res_[p];
+                if (d == 0) continue;
+                res_[p] = 0;
+                res_[rev_[p]] += d;
+                excess_[head_[p]] += d;
+                excess_[s] -= d;
+            }
+            globalRelabel(s, t);
+
+            const long long relabelPeriod = 6LL * n_ + static_cast<long long>(head_.size());
+            while (highest_ >= 0) {
+                int u = activeHead_[highest_];
+                if (u == -1) {
+                    --highest_;
+                    continue;
+                }
+                activeHead_[highest_] = activeNext_[u];
+                discharge(u, t);
+                if (work_ >= relabelPeriod) globalRelabel(s, t);
+            }
+            value_ = excess_[t];
+            state_ = State::Preflow;
+            return value_;
+        }
+
+        // Source side = vertices that cannot reach t in the residual graph,
+        // which is a minimum cut after either solver.
+        Cut minCut() const {
+            if (state_ == State::None) throw std::logic_error("MaxFlow: minCut() needs a previous solve");
+            std::vector<char> sinkSide(n_, 0);
+            std::vector<int> queue{t_};
+            sinkSide[t_] = 1;
+            for (std::size_t i = 0; i < queue.size(); ++i) {
+                int u = queue[i];
+                for (long long p = offsets_[u]; p < offsets_[u + 1]; ++p) {
+                    int v = head_[p];
+                    if (!sinkSide[v] && res_[rev_[p]] > 0) {
+                        sinkSide[v] = 1;
+                        queue.push_back(v);
+                    }
+                }
+            }
+
+            Cut cut;
+            for (int v = 0; v < n_; ++v) {
+                if (!sinkSide[v]) cut.sourceSide.push_back(v);
+            }
+            for (int e = 0; e < edgeCount(); ++e) {
+                if (cap_[e] > 0 && !sinkSide[from_[e]] && sinkSide[to_[e]]) {
+                    cut.edges.push_back(e);
+                    cut.capacity += cap_[e];
+                }
+            }
+            return cut;
+        }
+
+        // Set the capacity of edge e and repair the flow of the last dinic()
+        // solve. Returns the new maximum flow value.
+        Capacity updateCapacity(int e, Capacity capacity) {
+            if (e < 0 || e >= edgeCount()) throw std::out_of_range("MaxFlow: edge id out of range");
+            if (capacity < 0) throw std::invalid_argument("MaxFlow: negative capacity");
+            if (state_ != State::Flow) throw std::logic_error("MaxFlow: updateCapacity() needs a previous dinic() solve");
+
+            const long long fwd = pos_[2 * e], back = pos_[2 * e + 1];
+            const Capacity flow = cap_[e] - res_[fwd];
+            cap_[e] = capacity;
+            if (flow <= capacity) {
+                res_[fwd] = capacity - flow;
+            } else {
+                // Flow on e drops to `capacity`: from(e) keeps a surplus and
+                // to(e) a deficit of the difference.
+                Capacity surplus = flow - capacity;
+                res_[fwd] = 0;
+                res_[back] = capacity;
+                const int u = from_[e], v = to_[e];
+                if (u != v) {
+                    Capacity rerouted = augment(u, v, surplus);
+                    surplus -= rerouted;
+                }
+                if (surplus > 0) {
+                    settle(u, surplus, true);
+                    settle(v, surplus, false);
+                }
+            }
+            augment(s_, t_, kUnlimited);
+
+            value_ = netInflow(t_);
+            return value_;
+        }
+
+    private:
+        static constexpr Capacity kUnlimited = std::numeric_limits<Capacity>::max();
+
+        enum class State { None, Flow, Preflow };
+        int n_;
+        State state_ = State::None;
+        int s_ = 0, t_ = 0;
+        Capacity value_ = 0;
+        std::vector<int> from_, to_;
+        std::vector<Capacity> cap_;
+
+        // CSR layout, indexed by position.
+        std::vector<long long> offsets_;
+        std::vector<int> head_;
+        std::vector<Capacity> res_;
+        std::vector<long long> rev_;
+        std::vector<long long> pos_; // arc id -> position
+        std::vector<long long> cur_; // current arc per vertex
+
+        // dinic
+        std::vector<int> level_;
+        std::vector<int> queue_;
+        std::vector<long long> stack_;
+
+        // hlpp
+        std::vector<int> height_;
+        std::vector<Capacity> excess_;
+        std::vector<int> activeHead_, activeNext_;
+        std::vector<int> allHead_, allNext_, allPrev_;
+        int highest_ = -1, maxHeight_ = -1;
+        long long work_ = 0;
+
+        void prepare(int s, int t) {
+            if (s < 0 || s >= n_ || t < 0 || t >= n_) throw std::out_of_range("MaxFlow: terminal out of range");
+            if (s == t) throw std::invalid_argument("MaxFlow: source equals sink");
+            s_ = s;
+            t_ = t;
+            if (offsets_.empty() || pos_.size() != 2 * cap_.size()) build();
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                res_[pos_[2 * e]] = cap_[e];
+                res_[pos_[2 * e + 1]] = 0;
+            }
+            cur_.resize(n_);
+            level_.resize(n_);
+        }
+
+        void build() {
+            const std::size_t arcs = 2 * cap_.size();
+            offsets_.assign(n_ + 1, 0);
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                ++offsets_[from_[e] + 1];
+                ++offsets_[to_[e] + 1];
+            }
+            for (int u = 0; u < n_; ++u) offsets_[u + 1] += offsets_[u];
+
+            head_.resize(arcs);
+            res_.resize(arcs);
+            rev_.resize(arcs);
+            pos_.resize(arcs);
+            std::vector<long long> cursor(offsets_.begin(), offsets_.end() - 1);
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                long long fwd = cursor[from_[e]]++;
+                long long back = cursor[to_[e]]++;
+                head_[fwd] = to_[e];
+                head_[back] = from_[e];
+                rev_[fwd] = back;
+                rev_[back] = fwd;
+                pos_[2 * e] = fwd;
+                pos_[2 * e + 1] = back;
+            }
+        }
+
+        bool buildLevels(int s, int t) {
+            std::fill(level_.begin(), level_.end(), -1);
+            queue_.clear();
+            level_[s] = 0;
+            queue_.push_back(s);
+            for (std::size_t i = 0; i < queue_.size(); ++i) {
+                int u = queue_[i];
+                for (long long p = offsets_[u]; p < offsets_[u + 1]; ++p) {
+                    int v = head_[p];
+                    if (res_[p] > 0 && level_[v] == -1) {
+                        level_[v] = level_[u] + 1;
+                        if (v == t) return true;
+                        queue_.push_back(v);
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Dinic phases from s to t on the current residual graph, sending at most `limit`.
+        Capacity augment(int s, int t, Capacity limit) {
+            Capacity total = 0;
+            while (total < limit && buildLevels(s, t)) {
+                std::copy(offsets_.begin(), offsets_.end() - 1, cur_.begin());
+                total += blockingFlow(s, t, limit - total);
+            }
+            return total;
+        }
+
+        // Repeated DFS along level-increasing arcs with an explicit arc stack.
+        // After an augmentation the search resumes from the tail of the first
+        // saturated arc; dead ends are cut off by clearing their level.
+        Capacity blockingFlow(int s, int t, Capacity limit) {
+            Capacity total = 0;
+            stack_.clear();
+            int u = s;
+            for (;;) {
+                if (u == t) {
+                    Capacity d = limit - total;
+                    for (long long p : stack_) d = std::min(d, res_[p]);
+                    std::size_t cut = stack_.size();
+                    for (std::size_t i = 0; i < stack_.size(); ++i) {
+                        long long p = stack_[i];
+                        res_[p] -= d;
+                        res_[rev_[p]] += d;
+                        if (res_[p] == 0 && cut == stack_.size()) cut = i;
+                    }
+                    total += d;
+                    if (total == limit) break;
+                    u = head_[rev_[stack_[cut]]];
+                    stack_.resize(cut);
+                    continue;
+                }
+
+                long long& p = cur_[u];
+                for (; p < offsets_[u + 1]; ++p) {
+                    if (res_[p] > 0 && level_[head_[p]] == level_[u] + 1) break;
+                }
+                if (p < offsets_[u + 1]) {
+                    stack_.push_back(p);
+                    u = head_[p];
+                    continue;
+                }
+
+                level_[u] = -1;
+                if (stack_.empty()) break;
+                u = head_[rev_[stack_.back()]];
+                stack_.pop_back();
+                ++cur_[u];
+            }
+            return total;
+        }
+
+        // Move an imbalance at v to the terminals: a surplus is sent back to
+        // s (or on to t), a deficit is pulled from t (or from s).
+        void settle(int v, Capacity amount, bool surplus) {
+            for (int terminal : {surplus ? s_ : t_, surplus ? t_ : s_}) {
+                if (amount == 0 || v == s_ || v == t_) return;
+                amount -= surplus ? augment(v, terminal, amount) : augment(terminal, v, amount);
+            }
+            if (amount > 0) throw std::logic_error("MaxFlow: flow repair failed");
+        }
+
+        Capacity netInflow(int v) const {
+            Capacity total = 0;
+            for (int e = 0; e < edgeCount(); ++e) {
+                if (to_[e] == v) total += flow(e);
+                if (from_[e] == v) total -= flow(e);
+            }
+            return total;
+        }
+
+        void pushActive(int v) {
+            activeNext_[v] = activeHead_[height_[v]];
+            activeHead_[height_[v]] = v;
+            highest_ = std::max(highest_, height_[v]);
+        }
+
+        void linkHeight(int v) {
+            int h = height_[v];
+            allPrev_[v] = -1;
+            allNext_[v] = allHead_[h];
+            if (allHead_[h] != -1) allPrev_[allHead_[h]] = v;
+            allHead_[h] = v;
+            maxHeight_ = std::max(maxHeight_, h);
+        }
+
+        void unlinkHeight(int v) {
+            int h = height_[v];
+            if (allPrev_[v] != -1) allNext_[allPrev_[v]] = allNext_[v];
+            else allHead_[h] = allNext_[v];
+            if (allNext_[v] != -1) allPrev_[allNext_[v]] = allPrev_[v];
+        }
+
+        // Exact distance-to-t labels; vertices that cannot reach t get n and
+        // are left alone for the rest of phase one.
+        void globalRelabel(int s, int t) {
+            work_ = 0;
+            std::fill(height_.begin(), height_.end(), n_);
+            std::fill(activeHead_.begin(), activeHead_.end(), -1);
+            std::fill(allHead_.begin(), allHead_.end(), -1);
+            highest_ = maxHeight_ = -1;
+
+            queue_.clear();
+            height_[t] = 0;
+            queue_.push_back(t);
+            for (std::size_t i = 0; i < queue_.size(); ++i) {
+                int u = queue_[i];
+                linkHeight(u);
+                if (excess_[u] > 0 && u != t) pushActive(u);
+                for (long long p = offsets_[u]; p < offsets_[u + 1]; ++p) {
+                    int v = head_[p];
+                    if (v != s && height_[v] == n_ && res_[rev_[p]] > 0) {
+                        height_[v] = height_[u] + 1;
+                        queue_.push_back(v);
+                    }
+                }
+            }
+            std::copy(offsets_.begin(), offsets_.end() - 1, cur_.begin());
+        }
+
+        void discharge(int u, int t) {
+            for (;;) {
+                const int h = height_[u];
+                for (long long& p = cur_[u]; p < offsets_[u + 1]; ++p) {
+                    int v = head_[p];
+                    if (res_[p] == 0 || height_[v] + 1 != h) continue;
+                    Capacity d = std::min(excess_[u], res_[p]);
+                    if (excess_[v] == 0 && v != t) pushActive(v);
+                    res_[p] -= d;
+                    res_[rev_[p]] += d;
+                    excess_[u] -= d;
+                    excess_[v] += d;
+                    if (excess_[u] == 0) return;
+                }
+
+                // Relabel.
+                int lowest = n_;
+                work_ += offsets_[u + 1] - offsets_[u] + 12;
+                for (long long p = offsets_[u]; p < offsets_[u + 1]; ++p) {
+                    if (res_[p] > 0) lowest = std::min(lowest, height_[head_[p]] + 1);
+                }
+                cur_[u] = offsets_[u];
+                unlinkHeight(u);
+
+                if (allHead_[h] == -1) {
+                    // Gap: nothing above h can reach t any more.
+                    for (int g = h + 1; g <= maxHeight_; ++g) {
+                        for (int v = allHead_[g]; v != -1; v = allNext_[v]) height_[v] = n_;
+                        allHead_[g] = -1;
+                        activeHead_[g] = -1;
+                    }
+                    maxHeight_ = h - 1;
+                    height_[u] = n_;
+                    return;
+                }
+                if (lowest >= n_) {
+                    height_[u] = n_;
+                    return;
+                }
+                height_[u] = lowest;
+                linkHeight(u);
+                highest_ = std::max(highest_, lowest);
+            }
+        }
+    };
+
+} // namespace algo
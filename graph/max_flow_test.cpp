@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+#include "graph/max_flow.hpp"
+
+#include <climits>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    struct Arc {
+        int from, to;
+        long long cap;
+    };
+
+    struct Network {
+        int n, s, t;
+        vector<Arc> arcs;
+    };
+
+    // Edmonds-Karp on an adjacency matrix, reference for small networks.
+    long long edmondsKarp(const Network& net) {
+        vector<vector<long long>> r(net.n, vector<long long>(net.n, 0));
+        for (const Arc& a : net.arcs) r[a.from][a.to] += a.cap;
+        long long total = 0;
+        for (;;) {
+            vector<int> prev(net.n, -1);
+            prev[net.s] = net.s;
+            queue<int> q;
+            q.push(net.s);
+            while (!q.empty() && prev[net.t] == -1) {
+                int u = q.front();
+                q.pop();
+                for (int v = 0; v < net.n; v++) {
+                    if (prev[v] == -1 && r[u][v] > 0) {
+                        prev[v] = u;
+                        q.push(v);
+                    }
+                }
+            }
+            if (prev[net.t] == -1) return total;
+            long long d = LLONG_MAX;
+            for (int v = net.t; v != net.s; v = prev[v]) d = min(d, r[prev[v]][v]);
+            for (int v = net.t; v != net.s; v = prev[v]) {
+                r[prev[v]][v] -= d;
+                r[v][prev[v]] += d;
+            }
+            total += d;
+        }
+    }
+
+    algo::MaxFlow build(const Network& net) {
+        algo::MaxFlow mf(net.n);
+        for (const Arc& a : net.arcs) mf.addEdge(a.from, a.to, a.cap);
+        return mf;
+    }
+
+    // Capacity limits and conservation at every vertex except s and t.
+    void expectValidFlow(const algo::MaxFlow& mf, const Network& net, long long value) {
+        vector<long long> balance(net.n, 0);
+        for (int e = 0; e < mf.edgeCount(); e++) {
+            ASSERT_GE(mf.flow(e), 0);
+            ASSERT_LE(mf.flow(e), mf.capacity(e));
+            balance[mf.from(e)] -= mf.flow(e);
+            balance[mf.to(e)] += mf.flow(e);
+        }
+        for (int v = 0; v < net.n; v++) {
+            if (v == net.s) EXPECT_EQ(balance[v], -value);
+            else if (v == net.t) EXPECT_EQ(balance[v], value);
+            else EXPECT_EQ(balance[v], 0) << "vertex " << v;
+        }
+    }
+
+    Network randomNetwork(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        Network net{n, 0, n - 1, {}};
+        for (int i = 0; i < m; i++) net.arcs.push_back({(int) (rng() % n), (int) (rng() % n), (long long) (rng() % 100)});
+        return net;
+    }
+
+    // Layers of `width` vertices, complete random connections between neighbouring layers.
+    Network layeredNetwork(int layers, int width, unsigned seed) {
+        mt19937 rng(seed);
+        Network net{layers * width + 2, layers * width, layers * width + 1, {}};
+        for (int i = 0; i < width; i++) {
+            net.arcs.push_back({net.s, i, 1000});
+            net.arcs.push_back({(layers - 1) * width + i, net.t, 1000});
+        }
+        for (int l = 0; l + 1 < layers; l++) {
+            for (int i = 0; i < width; i++) {
+                for (int j = 0; j < width; j++) {
+                    if (rng() % 3 == 0) net.arcs.push_back({l * width + i, (l + 1) * width + j, (long long) (rng() % 50 + 1)});
+                }
+            }
+        }
+        return net;
+    }
+
+    Network gridNetwork(int side, unsigned seed) {
+        mt19937 rng(seed);
+        Network net{side * side, 0, side * side - 1, {}};
+        for (int r = 0; r < side; r++) {
+            for (int c = 0; c < side; c++) {
+                int u = r * side + c;
+                if (c + 1 < side) {
+                    net.arcs.push_back({u, u + 1, (long long) (rng() % 20)});
+                    net.arcs.push_back({u + 1, u, (long long) (rng() % 20)});
+                }
+                if (r + 1 < side) {
+                    net.arcs.push_back({u, u + side, (long long) (rng() % 20)});
+                    net.arcs.push_back({u + side, u, (long long) (rng() % 20)});
+                }
+            }
+        }
+        return net;
+    }
+
+    // Unit-capacity bipartite matching network.
+    Network bipartiteNetwork(int left, int right, int degree, unsigned seed) {
+        mt19937 rng(seed);
+        Network net{left + right + 2, left + right, left + right + 1, {}};
+        for (int i = 0; i < left; i++) net.arcs.push_back({net.s, i, 1});
+        for (int j = 0; j < right; j++) net.arcs.push_back({left + j, net.t, 1});
+        for (int i = 0; i < left; i++) {
+            for (int k = 0; k < degree; k++) net.arcs.push_back({i, left + (int) (rng() % right), 1});
+        }
+        return net;
+    }
+}
+
+TEST(MaxFlowTest, RandomNetworksMatchEdmondsKarp) {
+    for (unsigned seed = 1; seed <= 30; seed++) {
+        auto net = randomNetwork(12 + seed % 20, 60 + seed * 3, seed);
+        long long expected = edmondsKarp(net);
+        auto mf = build(net);
+        long long value = mf.dinic(net.s, net.t);
+        EXPECT_EQ(value, expected);
+        expectValidFlow(mf, net, value);
+        EXPECT_EQ(mf.hlpp(net.s, net.t), expected);
+        EXPECT_EQ(mf.dinic(net.s, net.t), expected);
+    }
+}
+
+TEST(MaxFlowTest, StructuredNetworks) {
+    vector<Network> nets = {layeredNetwork(8, 12, 3), gridNetwork(20, 4), bipartiteNetwork(60, 50, 3, 5)};
+    for (const auto& net : nets) {
+        long long expected = edmondsKarp(net);
+        auto mf = build(net);
+        EXPECT_EQ(mf.hlpp(net.s, net.t), expected);
+        long long value = mf.dinic(net.s, net.t);
+        EXPECT_EQ(value, expected);
+        expectValidFlow(mf, net, value);
+    }
+}
+
+TEST(MaxFlowTest, FromCsrGraph) {
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        auto net = randomNetwork(15 + seed, 80, seed);
+        vector<algo::CsrGraph<long long>::Edge> edges;
+        for (const Arc& a : net.arcs) edges.push_back({a.from, a.to, a.cap});
+        algo::CsrGraph<long long> g(net.n, edges);
+        algo::MaxFlow mf(g);
+        EXPECT_EQ(mf.edgeCount(), g.edgeCount());
+        for (int e = 0; e < mf.edgeCount(); e++) EXPECT_EQ(mf.capacity(e), g.weight(e));
+        EXPECT_EQ(mf.dinic(net.s, net.t), edmondsKarp(net));
+    }
+
+    // Capacities are taken as they are, or rejected when they do not fit.
+    algo::CsrGraph<unsigned long long> wide(2, {{0, 1, 1ULL << 40}});
+    EXPECT_EQ(algo::MaxFlow(wide).dinic(0, 1), 1LL << 40);
+    algo::CsrGraph<unsigned long long> huge(2, {{0, 1, ~0ULL}});
+    EXPECT_THROW(algo::MaxFlow{huge}, std::invalid_argument);
+    algo::CsrGraph<int> negative(2, {{0, 1, -1}});
+    EXPECT_THROW(algo::MaxFlow{negative}, std::invalid_argument);
+}
+
+TEST(MaxFlowTest, LongPathDoesNotRecurse) {
+    const int n = 300000;
+    algo::MaxFlow mf(n);
+    for (int i = 0; i + 1 < n; i++) mf.addEdge(i, i + 1, 1000000000000LL + i);
+    EXPECT_EQ(mf.dinic(0, n - 1), 1000000000000LL);
+    EXPECT_EQ(mf.hlpp(0, n - 1), 1000000000000LL);
+}
+
+TEST(MaxFlowTest, EdgesAddedAfterSolve) {
+    algo::MaxFlow mf(4);
+    int a = mf.addEdge(0, 1, 5);
+    mf.addEdge(1, 3, 3);
+    EXPECT_EQ(mf.dinic(0, 3), 3);
+    EXPECT_EQ(mf.flow(a), 3);
+    mf.addEdge(1, 2, 4);
+    int d = mf.addEdge(2, 3, 1);
+    EXPECT_EQ(mf.flow(d), 0);
+    EXPECT_EQ(mf.dinic(0, 3), 4);
+    EXPECT_EQ(mf.flow(d), 1);
+    EXPECT_EQ(mf.edgeCount(), 4);
+}
+
+TEST(MaxFlowTest, InvalidArguments) {
+    algo::MaxFlow mf(3);
+    EXPECT_THROW(mf.addEdge(0, 3, 1), std::out_of_range);
+    EXPECT_THROW(mf.addEdge(0, 1, -1), std::invalid_argument);
+    EXPECT_THROW(mf.dinic(1, 1), std::invalid_argument);
+    EXPECT_THROW(mf.hlpp(0, 5), std::out_of_range);
+    EXPECT_EQ(mf.dinic(0, 2), 0);
+}
+
+TEST(MaxFlowTest, MinCutMatchesFlowValue) {
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        auto net = randomNetwork(15 + seed % 10, 70 + seed * 2, seed);
+        auto mf = build(net);
+        for (int solver = 0; solver < 2; solver++) {
+            long long value = solver == 0 ? mf.dinic(net.s, net.t) : mf.hlpp(net.s, net.t);
+            auto cut = mf.minCut();
+            EXPECT_EQ(cut.capacity, value);
+            vector<char> side(net.n, 0);
+            for (int v : cut.sourceSide) side[v] = 1;
+            EXPECT_TRUE(side[net.s]);
+            EXPECT_FALSE(side[net.t]);
+            long long crossing = 0;
+            for (int e = 0; e < mf.edgeCount(); e++) {
+                if (side[mf.from(e)] && !side[mf.to(e)]) crossing += mf.capacity(e);
+            }
+            EXPECT_EQ(crossing, value);
+            for (int e : cut.edges) {
+                EXPECT_TRUE(side[mf.from(e)] && !side[mf.to(e)]);
+            }
+        }
+    }
+}
+
+TEST(MaxFlowTest, IncrementalUpdatesMatchFreshSolve) {
+    mt19937 rng(17);
+    vector<Network> nets = {randomNetwork(30, 150, 3), gridNetwork(8, 6), layeredNetwork(5, 6, 8)};
+    for (auto net : nets) {
+        auto mf = build(net);
+        mf.dinic(net.s, net.t);
+        for (int step = 0; step < 200; step++) {
+            int e = rng() % net.arcs.size();
+            long long cap = rng() % 4 == 0 ? 0 : (long long) (rng() % 120);
+            if (rng() % 2) cap = mf.flow(e) / 2;
+            net.arcs[e].cap = cap;
+
+            long long value = mf.updateCapacity(e, cap);
+            ASSERT_EQ(value, edmondsKarp(net)) << "step " << step;
+            EXPECT_EQ(mf.value(), value);
+            expectValidFlow(mf, net, value);
+        }
+        EXPECT_EQ(mf.minCut().capacity, mf.value());
+    }
+}
+
+TEST(MaxFlowTest, IncrementalModeNeedsDinic) {
+    algo::MaxFlow mf(3);
+    int a = mf.addEdge(0, 1, 4);
+    mf.addEdge(1, 2, 3);
+    EXPECT_THROW(mf.minCut(), std::logic_error);
+    EXPECT_THROW(mf.updateCapacity(a, 1), std::logic_error);
+    mf.hlpp(0, 2);
+    EXPECT_THROW(mf.updateCapacity(a, 1), std::logic_error);
+    EXPECT_EQ(mf.dinic(0, 2), 3);
+    EXPECT_EQ(mf.updateCapacity(a, 1), 1);
+    EXPECT_EQ(mf.updateCapacity(a, 10), 3);
+    EXPECT_THROW(mf.updateCapacity(5, 1), std::out_of_range);
+    EXPECT_THROW(mf.updateCapacity(a, -2), std::invalid_argument);
+    mf.addEdge(0, 2, 1);
+    EXPECT_THROW(mf.updateCapacity(a, 1), std::logic_error);
+}
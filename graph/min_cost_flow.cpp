@@ -4,6 +4,9 @@
 
 using namespace std;
 
+// For large or CSR-shaped networks use algo::MinCostFlow (min_cost_flow.hpp),
+// which keeps its edges in flat arrays and also takes a
+// CsrGraph<algo::MinCostFlow::Arc> directly.
 struct MinCostFlow {
     const int oo = 1 << 30;
 
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "data_structure/indexed_heap.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/spfa.hpp"
+
+namespace algo {
+
+    // Minimum cost flow by successive shortest paths (primal-dual), 64-bit
+    // capacities and costs.
+    //
+    // Johnson potentials keep every reduced cost c(u, v) + h(u) - h(v) of a
+    // residual arc non-negative, so each shortest path is found by Dijkstra
+    // on an indexed heap instead of a Bellman-Ford pass. Initial potentials
+    // are 0, or Bellman-Ford distances from s when some cost is negative; a
+    // negative cost cycle reachable from s is rejected. Dijkstra stops as
+    // soon as t is settled, and vertices it did not settle get d(t) added to
+    // their potential, which keeps reduced costs non-negative.
+    //
+    // Each path is augmented by its bottleneck by walking predecessor arcs,
+    // without recursion. solve(s, t, limit) sends at most `limit` units; the
+    // flow it sends is the cheapest among all flows of that value.
+    //
+    // Storage matches MaxFlow: edge e is arcs 2e / 2e + 1, laid out in CSR
+    // order before solving. Every solve starts from zero flow. A network that
+    // is already a CsrGraph<MinCostFlow::Arc> (capacity and cost per arc) can
+    // be passed to the constructor as is.
+    class MinCostFlow {
+    public:
+        using Flow = long long;
+        using Cost = long long;
+        static constexpr Flow kUnlimited = std::numeric_limits<Flow>::max();
+
+        static constexpr int kMaxEdges = std::numeric_limits<int>::max() / 2;
+
+        struct Result {
+            Flow flow = 0;
+            Cost cost = 0;
+        };
+
+        // Arc weight of a CsrGraph network.
+        struct Arc {
+            Flow capacity = 0;
+            Cost cost = 0;
+        };
+
+        explicit MinCostFlow(int n = 0) : n_(n), heap_(n) {
+            if (n < 0) throw std::invalid_argument("MinCostFlow: negative vertex count");
+        }
+
+        // One edge per arc of g, so edge ids are the arc indices of g. Build g
+        // without reverseEdges: the residual arcs are added here.
+        explicit MinCostFlow(const CsrGraph<Arc>& g) : MinCostFlow(g.size()) {
+            if (g.edgeCount() > kMaxEdges) {
+                throw std::length_error("MinCostFlow: " + std::to_string(g.edgeCount()) + " arcs, at most " +
+                                        std::to_string(kMaxEdges) + " are supported");
+            }
+            const auto m = static_cast<std::size_t>(g.edgeCount());
+            from_.resize(m);
+            to_.assign(g.targets().begin(), g.targets().end());
+            cap_.resize(m);
+            cost_.resize(m);
+            for (int u = 0; u < n_; ++u) {
+                for (long long e = g.begin(u); e < g.end(u); ++e) {
+                    const Arc& a = g.weight(e);
+                    if (a.capacity < 0) throw std::invalid_argument("MinCostFlow: negative capacity");
+                    from_[e] = u;
+                    cap_[e] = a.capacity;
+                    cost_[e] = a.cost;
+                }
+            }
+        }
+
+        int size() const { return n_; }
+        int edgeCount() const { return static_cast<int>(cap_.size()); }
+
+        void reserve(int edges) {
+            from_.reserve(edges);
+            to_.reserve(edges);
+            cap_.reserve(edges);
+            cost_.reserve(edges);
+        }
+
+        // Returns the id of the new edge; ids are 0, 1, 2, ... in insertion order.
+        int addEdge(int from, int to, Flow capacity, Cost cost) {
+            if (from < 0 || from >= n_ || to < 0 || to >= n_) {
+                throw std::out_of_range("MinCostFlow: edge (" + std::to_string(from) + ", " + std::to_string(to) +
+                                        ") out of range");
+            }
+            if (capacity < 0) throw std::invalid_argument("MinCostFlow: negative capacity");
+            if (cap_.size() >= static_cast<std::size_t>(kMaxEdges)) {
+                throw std::length_error("MinCostFlow: too many edges");
+            }
+            from_.push_back(from);
+            to_.push_back(to);
+            cap_.push_back(capacity);
+            cost_.push_back(cost);
+            return static_cast<int>(cap_.size()) - 1;
+        }
+
+        int from(int e) const { return from_[e]; }
+        int to(int e) const { return to_[e]; }
+        Flow capacity(int e) const { return cap_[e]; }
+        Cost cost(int e) const { return cost_[e]; }
+
+        // Flow on edge e after the last solve.
+        Flow flow(int e) const {
+            if (static_cast<std::size_t>(2 * e) >= pos_.size()) return 0;
+            return cap_[e] - res_[pos_[2 * e]];
+        }
+
+        // Number of shortest path computations in the last solve.
+        long long augmentations() const { return augmentations_; }
+
+        Result solve(int s, int t, Flow limit = kUnlimited) {
+            if (s < 0 || s >= n_ || t < 0 || t >= n_) throw std::out_of_range("MinCostFlow: terminal out of range");
+            if (s == t) throw std::invalid_argument("MinCostFlow: source equals sink");
+            if (limit < 0) throw std::invalid_argument("MinCostFlow: negative flow limit");
+            prepare();
+            initPotentials(s);
+
+            Result result;
+            augmentations_ = 0;
+            while (result.flow < limit && shortestPath(s, t)) {
+                ++augmentations_;
+                Flow d = limit - result.flow;
+                for (int v = t; v != s; v = head_[rev_[prev_[v]]]) d = std::min(d, res_[prev_[v]]);
+                Cost pathCost = 0;
+                for (int v = t; v != s; v = head_[rev_[prev_[v]]]) {
+                    long long p = prev_[v];
+                    res_[p] -= d;
+                    res_[rev_[p]] += d;
+                    pathCost += arcCost_[p];
+                }
+                result.flow += d;
+                result.cost += d * pathCost;
+            }
+            return result;
+        }
+
+    private:
+        static constexpr Cost kInfinity = std::numeric_limits<Cost>::max();
+
+        int n_;
+        std::vector<int> from_, to_;
+        std::vector<Flow> cap_;
+        std::vector<Cost> cost_;
+        long long augmentations_ = 0;
+
+        // CSR layout, indexed by position.
+        std::vector<long long> offsets_;
+        std::vector<int> head_;
+        std::vector<Flow> res_;
+        std::vector<Cost> arcCost_;
+        std::vector<long long> rev_;
+        std::vector<long long> pos_; // arc id -> position
+
+        std::vector<Cost> potential_, dist_;
+        std::vector<long long> prev_; // arc position used to reach v
+        std::vector<char> done_;
+        IndexedHeap<Cost> heap_;
+
+        void prepare() {
+            if (offsets_.empty() || pos_.size() != 2 * cap_.size()) build();
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                res_[pos_[2 * e]] = cap_[e];
+                res_[pos_[2 * e + 1]] = 0;
+            }
+        }
+
+        void build() {
+            const std::size_t arcs = 2 * cap_.size();
+            offsets_.assign(n_ + 1, 0);
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                ++offsets_[from_[e] + 1];
+                ++offsets_[to_[e] + 1];
+            }
+            for (int u = 0; u < n_; ++u) offsets_[u + 1] += offsets_[u];
+
+            head_.resize(arcs);
+            res_.resize(arcs);
+            arcCost_.resize(arcs);
+            rev_.resize(arcs);
+            pos_.resize(arcs);
+            std::vector<long long> cursor(offsets_.begin(), offsets_.end() - 1);
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                long long fwd = cursor[from_[e]]++;
+                long long back = cursor[to_[e]]++;
+                head_[fwd] = to_[e];
+                head_[back] = from_[e];
+                arcCost_[fwd] = cost_[e];
+                arcCost_[back] = -cost_[e];
+                rev_[fwd] = back;
+                rev_[back] = fwd;
+                pos_[2 * e] = fwd;
+                pos_[2 * e + 1] = back;
+            }
+        }
+
+        void initPotentials(int s) {
+            potential_.assign(n_, 0);
+            bool negative = false;
+            for (std::size_t e = 0; e < cap_.size(); ++e) negative |= cap_[e] > 0 && cost_[e] < 0;
+            if (!negative) return;
+
+            std::vector<CsrGraph<Cost>::Edge> arcs;
+            for (std::size_t e = 0; e < cap_.size(); ++e) {
+                if (cap_[e] > 0) arcs.push_back({from_[e], to_[e], cost_[e]});
+            }
+            CsrGraph<Cost> residual(n_, arcs);
+            Spfa spfa;
+            if (!spfa.run(residual, s)) throw std::invalid_argument("MinCostFlow: negative cost cycle");
+            for (int v = 0; v < n_; ++v) {
+                if (spfa.reached(v)) potential_[v] = spfa.distance(v);
+            }
+        }
+
+        // Dijkstra on reduced costs; updates potentials, returns false when t is unreachable.
+        bool shortestPath(int s, int t) {
+            dist_.assign(n_, kInfinity);
+            done_.assign(n_, 0);
+            prev_.assign(n_, -1);
+            heap_.reset();
+
+            dist_[s] = 0;
+            heap_.push(s, 0);
+            while (!heap_.empty()) {
+                int u = heap_.pop();
+                done_[u] = 1;
+                if (u == t) break;
+                for (long long p = offsets_[u]; p < offsets_[u + 1]; ++p) {
+                    if (res_[p] == 0) continue;
+                    int v = head_[p];
+                    Cost nd = dist_[u] + arcCost_[p] + potential_[u] - potential_[v];
+                    if (nd >= dist_[v]) continue;
+                    dist_[v] = nd;
+                    prev_[v] = p;
+                    heap_.update(v, nd);
+                }
+            }
+            if (!done_[t]) return false;
+
+            for (int v = 0; v < n_; ++v) potential_[v] += done_[v] ? dist_[v] : dist_[t];
+            return true;
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include "graph/min_cost_flow.hpp"
+
+#include <climits>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    struct Arc {
+        int from, to;
+        long long cap, cost;
+    };
+
+    struct Network {
+        int n, s, t;
+        vector<Arc> arcs;
+    };
+
+    // Successive shortest paths with Bellman-Ford, reference for small networks.
+    pair<long long, long long> reference(const Network& net, long long limit) {
+        struct E { int to; long long cap, cost; int rev; };
+        vector<vector<E>> g(net.n);
+        for (const Arc& a : net.arcs) {
+            g[a.from].push_back({a.to, a.cap, a.cost, (int) g[a.to].size()});
+            g[a.to].push_back({a.from, 0, -a.cost, (int) g[a.from].size() - 1});
+        }
+        const long long inf = LLONG_MAX;
+        long long flow = 0, cost = 0;
+        while (flow < limit) {
+            vector<long long> dist(net.n, inf);
+            vector<pair<int, int>> prev(net.n, {-1, -1});
+            dist[net.s] = 0;
+            for (int round = 0; round < net.n; round++) {
+                for (int u = 0; u < net.n; u++) {
+                    if (dist[u] == inf) continue;
+                    for (int i = 0; i < (int) g[u].size(); i++) {
+                        const E& e = g[u][i];
+                        if (e.cap > 0 && dist[u] + e.cost < dist[e.to]) {
+                            dist[e.to] = dist[u] + e.cost;
+                            prev[e.to] = {u, i};
+                        }
+                    }
+                }
+            }
+            if (dist[net.t] == inf) break;
+            long long d = limit - flow;
+            for (int v = net.t; v != net.s; v = prev[v].first) d = min(d, g[prev[v].first][prev[v].second].cap);
+            for (int v = net.t; v != net.s; v = prev[v].first) {
+                E& e = g[prev[v].first][prev[v].second];
+                e.cap -= d;
+                g[v][e.rev].cap += d;
+            }
+            flow += d;
+            cost += d * dist[net.t];
+        }
+        return {flow, cost};
+    }
+
+    // Random network with some negative costs but no negative cycle:
+    // cost(u, v) = c' - p(u) + p(v) with c' >= 0.
+    Network randomNetwork(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        vector<long long> p(n);
+        for (auto& x : p) x = rng() % 40;
+        Network net{n, 0, n - 1, {}};
+        for (int i = 0; i < m; i++) {
+            int u = rng() % n, v = rng() % n;
+            net.arcs.push_back({u, v, (long long) (rng() % 20), (long long) (rng() % 30) - p[u] + p[v]});
+        }
+        return net;
+    }
+
+    algo::MinCostFlow build(const Network& net) {
+        algo::MinCostFlow mcf(net.n);
+        for (const Arc& a : net.arcs) mcf.addEdge(a.from, a.to, a.cap, a.cost);
+        return mcf;
+    }
+
+    void expectValidFlow(const algo::MinCostFlow& mcf, const Network& net, algo::MinCostFlow::Result r) {
+        vector<long long> balance(net.n, 0);
+        long long cost = 0;
+        for (int e = 0; e < mcf.edgeCount(); e++) {
+            ASSERT_GE(mcf.flow(e), 0);
+            ASSERT_LE(mcf.flow(e), mcf.capacity(e));
+            balance[mcf.from(e)] -= mcf.flow(e);
+            balance[mcf.to(e)] += mcf.flow(e);
+            cost += mcf.flow(e) * mcf.cost(e);
+        }
+        EXPECT_EQ(cost, r.cost);
+        for (int v = 0; v < net.n; v++) {
+            if (v == net.s) EXPECT_EQ(balance[v], -r.flow);
+            else if (v == net.t) EXPECT_EQ(balance[v], r.flow);
+            else EXPECT_EQ(balance[v], 0);
+        }
+    }
+}
+
+TEST(MinCostFlowTest, MatchesReference) {
+    for (unsigned seed = 1; seed <= 25; seed++) {
+        auto net = randomNetwork(10 + seed % 15, 50 + seed * 4, seed);
+        auto mcf = build(net);
+        auto expected = reference(net, LLONG_MAX);
+        auto r = mcf.solve(net.s, net.t);
+        EXPECT_EQ(r.flow, expected.first);
+        EXPECT_EQ(r.cost, expected.second);
+        expectValidFlow(mcf, net, r);
+
+        long long limit = expected.first / 2;
+        auto partial = mcf.solve(net.s, net.t, limit);
+        auto expectedPartial = reference(net, limit);
+        EXPECT_EQ(partial.flow, expectedPartial.first);
+        EXPECT_EQ(partial.cost, expectedPartial.second);
+        expectValidFlow(mcf, net, partial);
+    }
+}
+
+TEST(MinCostFlowTest, DenseTransportNetwork) {
+    // Complete bipartite supply -> demand network, the shape where the SPFA
+    // version spends most of its time.
+    const int left = 30, right = 30;
+    mt19937 rng(4);
+    Network net{left + right + 2, left + right, left + right + 1, {}};
+    for (int i = 0; i < left; i++) net.arcs.push_back({net.s, i, (long long) (rng() % 50 + 1), 0});
+    for (int j = 0; j < right; j++) net.arcs.push_back({left + j, net.t, (long long) (rng() % 50 + 1), 0});
+    for (int i = 0; i < left; i++) {
+        for (int j = 0; j < right; j++) net.arcs.push_back({i, left + j, 1000, (long long) (rng() % 1000)});
+    }
+    auto mcf = build(net);
+    auto r = mcf.solve(net.s, net.t);
+    auto expected = reference(net, LLONG_MAX);
+    EXPECT_EQ(r.flow, expected.first);
+    EXPECT_EQ(r.cost, expected.second);
+    EXPECT_GT(mcf.augmentations(), 0);
+}
+
+TEST(MinCostFlowTest, FromCsrGraph) {
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        auto net = randomNetwork(12 + seed, 60, seed);
+        vector<algo::CsrGraph<algo::MinCostFlow::Arc>::Edge> edges;
+        for (const Arc& a : net.arcs) edges.push_back({a.from, a.to, {a.cap, a.cost}});
+        algo::CsrGraph<algo::MinCostFlow::Arc> g(net.n, edges);
+        algo::MinCostFlow fromCsr(g);
+        ASSERT_EQ(fromCsr.edgeCount(), g.edgeCount());
+        for (int e = 0; e < fromCsr.edgeCount(); e++) {
+            EXPECT_EQ(fromCsr.to(e), g.target(e));
+            EXPECT_EQ(fromCsr.capacity(e), g.weight(e).capacity);
+            EXPECT_EQ(fromCsr.cost(e), g.weight(e).cost);
+        }
+
+        auto edgeByEdge = build(net);
+        auto r = fromCsr.solve(net.s, net.t);
+        auto expected = edgeByEdge.solve(net.s, net.t);
+        EXPECT_EQ(r.flow, expected.flow);
+        EXPECT_EQ(r.cost, expected.cost);
+        expectValidFlow(fromCsr, net, r);
+    }
+
+    algo::CsrGraph<algo::MinCostFlow::Arc> negative(2, {{0, 1, {-1, 0}}});
+    EXPECT_THROW(algo::MinCostFlow{negative}, std::invalid_argument);
+}
+
+TEST(MinCostFlowTest, SixtyFourBitCosts) {
+    algo::MinCostFlow mcf(3);
+    mcf.addEdge(0, 1, 3000000, 20000000);
+    mcf.addEdge(1, 2, 3000000, 30000000);
+    auto r = mcf.solve(0, 2);
+    EXPECT_EQ(r.flow, 3000000);
+    EXPECT_EQ(r.cost, 3000000LL * 50000000LL);
+}
+
+TEST(MinCostFlowTest, InvalidInput) {
+    algo::MinCostFlow mcf(4);
+    EXPECT_THROW(mcf.addEdge(0, 4, 1, 1), std::out_of_range);
+    EXPECT_THROW(mcf.addEdge(0, 1, -1, 1), std::invalid_argument);
+    mcf.addEdge(0, 1, 5, 1);
+    mcf.addEdge(1, 2, 5, -4);
+    mcf.addEdge(2, 1, 5, 2);
+    mcf.addEdge(2, 3, 5, 1);
+    EXPECT_THROW(mcf.solve(0, 3), std::invalid_argument);
+    EXPECT_THROW(mcf.solve(0, 0), std::invalid_argument);
+    EXPECT_THROW(mcf.solve(0, 3, -1), std::invalid_argument);
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_structure/disjoint_set.hpp"
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Minimum spanning forest by Kruskal on algo::DisjointSet, for integer or
+    // floating point weights.
+    //
+    // Edges are sorted by an LSD radix sort on an order-preserving unsigned
+    // image of the weight (sign bit flipped for signed integers, IEEE bits
+    // flipped for floats), 8 bits per pass; passes where every key has the
+    // same digit are skipped, so small weights in a wide type cost one or
+    // two passes.
+    //
+    // Filter-Kruskal (Osipov, Sanders, Singler 2009) avoids sorting most of
+    // the heavy edges: a range is split around a random pivot weight, the
+    // light part is solved first, then the heavy part drops every edge whose
+    // endpoints are already connected before it is split or sorted in turn.
+    // Ranges of at most max(n, kBaseCase) edges are radix sorted and scanned.
+    // Ranges are kept on an explicit stack, and the run stops as soon as
+    // n - 1 edges are chosen.
+    //
+    // solve() returns the chosen edges in non-decreasing weight order. It
+    // reorders, but never drops, the stored edges.
+    template <typename W>
+    class MinimumSpanningTree {
+        static_assert(std::is_arithmetic_v<W>, "MinimumSpanningTree: weights must be integers or floats");
+
+    public:
+        using Edge = typename CsrGraph<W>::Edge;
+        enum class Method { Kruskal, FilterKruskal };
+        static constexpr std::size_t kBaseCase = 1024;
+
+        explicit MinimumSpanningTree(int n) : n_(n) {
+            if (n < 0) throw std::invalid_argument("MinimumSpanningTree: negative vertex count");
+        }
+
+        // Takes every arc of the CSR graph; the two copies of an undirected edge
+        // do not change the result.
+        explicit MinimumSpanningTree(const CsrGraph<W>& g) : MinimumSpanningTree(g.size()) {
+            edges_.reserve(static_cast<std::size_t>(g.edgeCount()));
+            for (int u = 0; u < n_; ++u) {
+                for (auto [v, w] : g[u]) {
+                    if (u != v) edges_.push_back({u, v, w});
+                }
+            }
+        }
+
+        int size() const { return n_; }
+        std::size_t edgeCount() const { return edges_.size(); }
+        void reserve(std::size_t edges) { edges_.reserve(edges); }
+
+        void addEdge(int u, int v, W weight) {
+            if (u < 0 || u >= n_ || v < 0 || v >= n_) {
+                throw std::out_of_range("MinimumSpanningTree: edge (" + std::to_string(u) + ", " +
+                                        std::to_string(v) + ") out of range");
+            }
+            edges_.push_back({u, v, weight});
+        }
+
+        std::vector<Edge> solve(Method method = Method::FilterKruskal) {
+            DisjointSet dsu(n_);
+            std::vector<Edge> tree;
+            tree.reserve(n_ > 0 ? n_ - 1 : 0);
+            sorted_ = filtered_ = 0;
+            std::span<Edge> all(edges_);
+            if (method == Method::Kruskal) {
+                sortAndScan(all, dsu, tree);
+                return tree;
+            }
+
+            const std::size_t baseCase = std::max<std::size_t>(kBaseCase, static_cast<std::size_t>(n_));
+            std::mt19937_64 rng(edges_.size());
+            stack_.clear();
+            stack_.push_back({0, edges_.size(), Range::Split});
+            while (!stack_.empty() && !complete(tree)) {
+                Range r = stack_.back();
+                stack_.pop_back();
+                auto first = edges_.begin() + static_cast<std::ptrdiff_t>(r.lo);
+                auto last = edges_.begin() + static_cast<std::ptrdiff_t>(r.hi);
+                if (r.kind == Range::FilterSplit) {
+                    last = std::partition(first, last, [&](const Edge& e) { return dsu.find(e.from) != dsu.find(e.to); });
+                    filtered_ += r.hi - static_cast<std::size_t>(last - edges_.begin());
+                    r.hi = static_cast<std::size_t>(last - edges_.begin());
+                }
+                std::size_t count = r.hi - r.lo;
+                if (r.kind == Range::Scan) {
+                    scan(all.subspan(r.lo, count), dsu, tree);
+                    continue;
+                }
+                if (count <= baseCase) {
+                    sortAndScan(all.subspan(r.lo, count), dsu, tree);
+                    continue;
+                }
+
+                // light < pivot, equal == pivot (already sorted), heavy > pivot.
+                W pivot = first[static_cast<std::ptrdiff_t>(rng() % count)].weight;
+                auto equal = std::partition(first, last, [&](const Edge& e) { return e.weight < pivot; });
+                auto heavy = std::partition(equal, last, [&](const Edge& e) { return !(pivot < e.weight); });
+                std::size_t mid1 = static_cast<std::size_t>(equal - edges_.begin());
+                std::size_t mid2 = static_cast<std::size_t>(heavy - edges_.begin());
+                if (mid2 < r.hi) stack_.push_back({mid2, r.hi, Range::FilterSplit});
+                stack_.push_back({mid1, mid2, Range::Scan});
+                if (r.lo < mid1) stack_.push_back({r.lo, mid1, Range::Split});
+            }
+            return tree;
+        }
+
+        // Edges that went through the radix sort in the last solve.
+        std::size_t sortedEdges() const { return sorted_; }
+        // Edges discarded unsorted by the Filter-Kruskal filter step.
+        std::size_t filteredEdges() const { return filtered_; }
+
+        // Stable LSD radix sort of `edges` by weight; `buffer` is scratch.
+        static void radixSort(std::span<Edge> edges, std::vector<Edge>& buffer) {
+            constexpr int kPasses = static_cast<int>(sizeof(Key));
+            const std::size_t m = edges.size();
+            if (m < 64) {
+                std::stable_sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+                return;
+            }
+            std::vector<std::array<std::size_t, 256>> count(kPasses);
+            for (auto& c : count) c.fill(0);
+            for (const Edge& e : edges) {
+                Key k = key(e.weight);
+                for (int p = 0; p < kPasses; ++p) ++count[p][(k >> (8 * p)) & 0xff];
+            }
+
+            buffer.resize(std::max(buffer.size(), m));
+            Edge* src = edges.data();
+            Edge* dst = buffer.data();
+            for (int p = 0; p < kPasses; ++p) {
+                auto& c = count[p];
+                if (std::any_of(c.begin(), c.end(), [m](std::size_t x) { return x == m; })) continue;
+                std::size_t sum = 0;
+                for (auto& x : c) {
+                    std::size_t t = x;
+                    x = sum;
+                    sum += t;
+                }
+                for (std::size_t i = 0; i < m; ++i) dst[c[(key(src[i].weight) >> (8 * p)) & 0xff]++] = src[i];
+                std::swap(src, dst);
+            }
+            if (src != edges.data()) std::copy(src, src + m, edges.data());
+        }
+
+    private:
+        using Key = std::conditional_t<sizeof(W) <= 4, std::uint32_t, std::uint64_t>;
+
+        struct Range {
+            enum Kind : unsigned char { Split, FilterSplit, Scan };
+            std::size_t lo, hi;
+            Kind kind;
+        };
+
+        int n_;
+        std::vector<Edge> edges_;
+        std::vector<Edge> buffer_;
+        std::vector<Range> stack_;
+        std::size_t sorted_ = 0, filtered_ = 0;
+
+        // Order-preserving map from W to an unsigned key.
+        static Key key(W w) {
+            if constexpr (std::is_floating_point_v<W>) {
+                static_assert(sizeof(W) == 4 || sizeof(W) == 8, "MinimumSpanningTree: unsupported float type");
+                using Bits = std::conditional_t<sizeof(W) == 4, std::uint32_t, std::uint64_t>;
+                Bits b = std::bit_cast<Bits>(w);
+                constexpr Bits sign = Bits(1) << (8 * sizeof(Bits) - 1);
+                return static_cast<Key>(b & sign ? ~b : b | sign);
+            } else {
+                using U = std::make_unsigned_t<W>;
+                Key k = static_cast<U>(w);
+                if constexpr (std::is_signed_v<W>) k ^= Key(1) << (8 * sizeof(W) - 1);
+                return k;
+            }
+        }
+
+        bool complete(const std::vector<Edge>& tree) const { return static_cast<int>(tree.size()) + 1 >= n_; }
+
+        void sortAndScan(std::span<Edge> edges, DisjointSet& dsu, std::vector<Edge>& tree) {
+            sorted_ += edges.size();
+            radixSort(edges, buffer_);
+            scan(edges, dsu, tree);
+        }
+
+        void scan(std::span<const Edge> edges, DisjointSet& dsu, std::vector<Edge>& tree) {
+            for (const Edge& e : edges) {
+                if (complete(tree)) return;
+                int a = dsu.find(e.from), b = dsu.find(e.to);
+                if (a == b) continue;
+                dsu.merge(a, b);
+                tree.push_back(e);
+            }
+        }
+    };
+
+} // namespace algo
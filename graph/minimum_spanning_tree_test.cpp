@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "graph/minimum_spanning_tree.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    template <typename W>
+    using Edge = typename algo::CsrGraph<W>::Edge;
+
+    // Plain Kruskal with a comparison sort, reference weight and component count.
+    template <typename W>
+    pair<W, int> reference(int n, vector<Edge<W>> edges) {
+        sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) { return a.weight < b.weight; });
+        vector<int> p(n);
+        iota(p.begin(), p.end(), 0);
+        auto find = [&](int u) {
+            while (p[u] != u) u = p[u] = p[p[u]];
+            return u;
+        };
+        W total = 0;
+        int components = n;
+        for (const auto& e : edges) {
+            int a = find(e.from), b = find(e.to);
+            if (a == b) continue;
+            p[a] = b;
+            total += e.weight;
+            components--;
+        }
+        return {total, components};
+    }
+
+    template <typename W>
+    vector<Edge<W>> randomEdges(int n, int m, W lo, W hi, unsigned seed) {
+        mt19937 rng(seed);
+        vector<Edge<W>> edges;
+        for (int i = 0; i < m; i++) {
+            W w;
+            if constexpr (is_floating_point_v<W>) w = uniform_real_distribution<W>(lo, hi)(rng);
+            else w = uniform_int_distribution<W>(lo, hi)(rng);
+            edges.push_back({(int) (rng() % n), (int) (rng() % n), w});
+        }
+        return edges;
+    }
+
+    // Sorted output, no cycle, n - components edges, expected weight.
+    template <typename W>
+    void expectSpanningForest(int n, const vector<Edge<W>>& edges, const vector<Edge<W>>& tree) {
+        auto [weight, components] = reference<W>(n, edges);
+        ASSERT_EQ((int) tree.size(), n - components);
+        algo::DisjointSet dsu(n);
+        W total = 0;
+        for (size_t i = 0; i < tree.size(); i++) {
+            if (i > 0) {
+                EXPECT_LE(tree[i - 1].weight, tree[i].weight);
+            }
+            EXPECT_NE(dsu.find(tree[i].from), dsu.find(tree[i].to));
+            dsu.merge(tree[i].from, tree[i].to);
+            total += tree[i].weight;
+        }
+        if constexpr (is_floating_point_v<W>) EXPECT_NEAR(total, weight, 1e-6);
+        else EXPECT_EQ(total, weight);
+    }
+
+    template <typename W>
+    void checkBothMethods(int n, const vector<Edge<W>>& edges) {
+        for (auto method : {algo::MinimumSpanningTree<W>::Method::Kruskal, algo::MinimumSpanningTree<W>::Method::FilterKruskal}) {
+            algo::MinimumSpanningTree<W> mst(n);
+            for (const auto& e : edges) mst.addEdge(e.from, e.to, e.weight);
+            expectSpanningForest<W>(n, edges, mst.solve(method));
+        }
+    }
+}
+
+TEST(MinimumSpanningTreeTest, RadixSortMatchesStableSort) {
+    auto ints = randomEdges<int>(100, 5000, -1000000000, 1000000000, 1);
+    auto shorts = randomEdges<short>(100, 3000, -300, 300, 2);
+    auto longs = randomEdges<long long>(100, 5000, -(1LL << 50), 1LL << 50, 3);
+    auto doubles = randomEdges<double>(100, 5000, -1e9, 1e9, 4);
+    auto floats = randomEdges<float>(100, 5000, -5.0f, 5.0f, 5);
+    auto check = [](auto edges) {
+        using E = typename decltype(edges)::value_type;
+        auto expected = edges;
+        stable_sort(expected.begin(), expected.end(), [](const E& a, const E& b) { return a.weight < b.weight; });
+        vector<E> buffer;
+        algo::MinimumSpanningTree<decltype(E::weight)>::radixSort(edges, buffer);
+        for (size_t i = 0; i < edges.size(); i++) {
+            ASSERT_EQ(edges[i].weight, expected[i].weight);
+            ASSERT_EQ(edges[i].from, expected[i].from);
+            ASSERT_EQ(edges[i].to, expected[i].to);
+        }
+    };
+    check(ints);
+    check(shorts);
+    check(longs);
+    check(doubles);
+    check(floats);
+}
+
+TEST(MinimumSpanningTreeTest, RandomGraphsMatchReference) {
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        int n = 50 + seed * 37;
+        checkBothMethods<int>(n, randomEdges<int>(n, n * (1 + seed % 6), -50, 1000, seed));
+        checkBothMethods<long long>(n, randomEdges<long long>(n, n * 3, 0, 1LL << 40, seed));
+        checkBothMethods<double>(n, randomEdges<double>(n, n * 4, -1.0, 1.0, seed));
+    }
+}
+
+TEST(MinimumSpanningTreeTest, FilterKruskalSkipsHeavyEdges) {
+    const int n = 2000;
+    auto edges = randomEdges<int>(n, 400000, 0, 1000000, 7);
+    algo::MinimumSpanningTree<int> mst(n);
+    mst.reserve(edges.size());
+    for (const auto& e : edges) mst.addEdge(e.from, e.to, e.weight);
+    auto tree = mst.solve();
+    expectSpanningForest<int>(n, edges, tree);
+    EXPECT_LT(mst.sortedEdges(), edges.size() / 4);
+    EXPECT_EQ(mst.edgeCount(), edges.size());
+
+    mst.solve(algo::MinimumSpanningTree<int>::Method::Kruskal);
+    EXPECT_EQ(mst.sortedEdges(), edges.size());
+}
+
+TEST(MinimumSpanningTreeTest, EqualWeightsAndForests) {
+    // Two disjoint dense blocks, all weights equal.
+    const int n = 3000;
+    vector<Edge<int>> edges;
+    mt19937 rng(11);
+    for (int i = 0; i < 20000; i++) {
+        int block = i % 2 * (n / 2);
+        edges.push_back({block + (int) (rng() % (n / 2)), block + (int) (rng() % (n / 2)), 5});
+    }
+    checkBothMethods<int>(n, edges);
+}
+
+TEST(MinimumSpanningTreeTest, FromCsrGraph) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 1}, {1, 2, 2}, {2, 3, 3}, {3, 4, 5}, {0, 4, 6}, {0, 3, 3}, {3, 1, 4}, {2, 2, 0}};
+    algo::CsrGraph<int> g(5, edges, {.undirected = true});
+    algo::MinimumSpanningTree<int> mst(g);
+    auto tree = mst.solve();
+    int total = 0;
+    for (const auto& e : tree) total += e.weight;
+    EXPECT_EQ(tree.size(), 4u);
+    EXPECT_EQ(total, 11);
+}
+
+TEST(MinimumSpanningTreeTest, InvalidInput) {
+    EXPECT_THROW(algo::MinimumSpanningTree<int>(-1), std::invalid_argument);
+    algo::MinimumSpanningTree<int> mst(3);
+    EXPECT_THROW(mst.addEdge(0, 3, 1), std::out_of_range);
+    EXPECT_THROW(mst.addEdge(-1, 0, 1), std::out_of_range);
+    EXPECT_TRUE(mst.solve().empty());
+}
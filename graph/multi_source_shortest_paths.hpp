@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "graph/dijkstra.hpp"
+#include "misc/thread_pool.hpp"
+
+namespace algo {
+
+    // Distance rows from many sources at once.
+    //
+    // Sources are handed out to the pool's workers one at a time; each worker
+    // owns a Dijkstra workspace that is reused for all of its sources, so no
+    // per-source allocation happens after the first query of each worker.
+    // Row i of `out` (row-major, out[i * n + v]) receives the distances from
+    // sources[i]; unreachable vertices get Dijkstra::kInfinity.
+    template <typename Graph>
+    void multiSourceShortestPaths(const Graph& g, const std::vector<int>& sources,
+                                  std::span<Dijkstra::Distance> out, ThreadPool& pool,
+                                  Dijkstra::Frontier frontier = Dijkstra::Frontier::Heap) {
+        const std::size_t n = g.size();
+        if (out.size() < sources.size() * n) {
+            throw std::invalid_argument("multiSourceShortestPaths: output matrix too small");
+        }
+
+        std::vector<Dijkstra> workspaces;
+        workspaces.reserve(pool.size());
+        for (int i = 0; i < pool.size(); ++i) workspaces.emplace_back(static_cast<int>(n), frontier);
+
+        pool.forEach(sources.size(), [&](int worker, std::size_t i) {
+            Dijkstra& dijkstra = workspaces[worker];
+            dijkstra.run(g, sources[i]);
+            const auto& dist = dijkstra.distances();
+            std::copy(dist.begin(), dist.begin() + n, out.begin() + i * n);
+        });
+    }
+
+    // Convenience overload that sizes the matrix itself.
+    template <typename Graph>
+    std::vector<Dijkstra::Distance> multiSourceShortestPaths(const Graph& g, const std::vector<int>& sources,
+                                                             ThreadPool& pool) {
+        std::vector<Dijkstra::Distance> out(sources.size() * g.size());
+        multiSourceShortestPaths(g, sources, std::span<Dijkstra::Distance>(out), pool);
+        return out;
+    }
+
+    // "Nearest source" mode: one multi-source Dijkstra instead of one run per
+    // source. dist[v] is the distance to the closest source and owner[v] the
+    // index in `sources` of that source (-1 if v is unreachable).
+    template <typename Graph>
+    void nearestSource(const Graph& g, const std::vector<int>& sources,
+                       std::vector<Dijkstra::Distance>& dist, std::vector<int>& owner) {
+        const int n = static_cast<int>(g.size());
+        Dijkstra dijkstra(n, Dijkstra::Frontier::Heap, true);
+        dijkstra.run(g, std::span<const int>(sources));
+
+        dist.assign(dijkstra.distances().begin(), dijkstra.distances().begin() + n);
+        owner.assign(n, -1);
+        for (int i = 0; i < static_cast<int>(sources.size()); ++i) {
+            if (owner[sources[i]] == -1) owner[sources[i]] = i;
+        }
+
+        // Owners follow predecessor chains; each vertex is labelled once.
+        std::vector<int> chain;
+        for (int v : dijkstra.touched()) {
+            int u = v;
+            while (owner[u] == -1) {
+                chain.push_back(u);
+                u = dijkstra.predecessor(u);
+            }
+            for (int w : chain) owner[w] = owner[u];
+            chain.clear();
+        }
+    }
+
+} // namespace algo
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "graph/csr_graph.hpp"
+#include "graph/multi_source_shortest_paths.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    algo::CsrGraph<int> randomGraph(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        vector<algo::CsrGraph<int>::Edge> edges(m);
+        for (auto& e : edges) e = {(int) (rng() % n), (int) (rng() % n), (int) (rng() % 1000)};
+        return algo::CsrGraph<int>(n, edges);
+    }
+}
+
+TEST(MultiSourceShortestPathsTest, RowsMatchSingleRuns) {
+    auto g = randomGraph(400, 3000, 1);
+    vector<int> sources;
+    for (int s = 0; s < 400; s += 3) sources.push_back(s);
+
+    algo::ThreadPool pool(4);
+    auto matrix = algo::multiSourceShortestPaths(g, sources, pool);
+    ASSERT_EQ(matrix.size(), sources.size() * 400);
+
+    algo::Dijkstra dijkstra;
+    for (size_t i = 0; i < sources.size(); i++) {
+        dijkstra.run(g, sources[i]);
+        for (int v = 0; v < 400; v++) ASSERT_EQ(matrix[i * 400 + v], dijkstra.distance(v));
+    }
+
+    vector<long long> tooSmall(10);
+    EXPECT_THROW(algo::multiSourceShortestPaths(g, sources, span<long long>(tooSmall), pool),
+                 std::invalid_argument);
+}
+
+TEST(MultiSourceShortestPathsTest, NearestSource) {
+    auto g = randomGraph(300, 1500, 2);
+    vector<int> sources = {5, 77, 150, 299};
+
+    vector<long long> dist;
+    vector<int> owner;
+    algo::nearestSource(g, sources, dist, owner);
+
+    algo::ThreadPool pool(2);
+    auto matrix = algo::multiSourceShortestPaths(g, sources, pool);
+    for (int v = 0; v < 300; v++) {
+        long long best = algo::Dijkstra::kInfinity;
+        for (size_t i = 0; i < sources.size(); i++) best = min(best, matrix[i * 300 + v]);
+        ASSERT_EQ(dist[v], best);
+        if (best == algo::Dijkstra::kInfinity) {
+            EXPECT_EQ(owner[v], -1);
+        } else {
+            ASSERT_GE(owner[v], 0);
+            EXPECT_EQ(matrix[owner[v] * 300 + v], best);
+        }
+    }
+}
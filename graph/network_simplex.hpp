@@ -0,0 +1,427 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "graph/max_flow.hpp"
+
+namespace algo {
+
+    // Minimum cost flow by the primal network simplex method, 64-bit flows
+    // and costs. Takes the same addEdge(from, to, capacity, cost) input as
+    // MinCostFlow, but its running time does not grow with the amount of
+    // flow, which makes it the better choice for large supplies.
+    //
+    // Every vertex is joined to an artificial root by an arc of cost
+    // big-M = (max |cost| + 1) * (n + 1), which gives a feasible starting
+    // spanning tree. The tree is stored with parent / pred arc / preorder
+    // thread indices, subtree sizes and the last vertex of every subtree.
+    //
+    //   entering arc : block search, scan blocks of about sqrt(m) arcs
+    //                  cyclically and take the most negative reduced cost of
+    //                  the first block that has one.
+    //   leaving arc  : the LEMON rule (last blocking arc on the side of the
+    //                  cycle after the join vertex), which keeps the tree
+    //                  strongly feasible and prevents cycling.
+    //   tree update  : the subtree cut off by the leaving arc is re-rooted at
+    //                  the entering arc and its preorder is rebuilt, in
+    //                  O(subtree size + depth).
+    //
+    // run() solves the transshipment problem given by setSupply(); supplies
+    // must sum to zero. Negative cost cycles are allowed and are saturated.
+    // solve(s, t, limit) mirrors MinCostFlow::solve(): it finds F = the
+    // maximum flow capped at `limit` with MaxFlow, then routes F from s to t
+    // at minimum cost.
+    //
+    // The pivot loop (init, block search, findJoin, findLeavingArc,
+    // changeFlow, updatePotentials) follows NetworkSimplex from the LEMON
+    // graph library (https://lemon.cs.elte.hu), Copyright (C) 2003-2010
+    // Egervary Jeno Kombinatorikus Optimalizalasi Kutatocsoport (Egervary
+    // Research Group on Combinatorial Optimization, EGRES), distributed under
+    // the Boost Software License, Version 1.0.
+    class NetworkSimplex {
+    public:
+        using Flow = long long;
+        using Cost = long long;
+        static constexpr Flow kUnlimited = std::numeric_limits<Flow>::max();
+
+        enum class Status { Optimal, Infeasible, Unbounded };
+
+        struct Result {
+            Flow flow = 0;
+            Cost cost = 0;
+        };
+
+        explicit NetworkSimplex(int n = 0) : n_(n) {
+            if (n < 0) throw std::invalid_argument("NetworkSimplex: negative vertex count");
+            supply_.assign(n, 0);
+        }
+
+        int size() const { return n_; }
+        int edgeCount() const { return static_cast<int>(cap_.size()); }
+
+        void reserve(int edges) {
+            from_.reserve(edges);
+            to_.reserve(edges);
+            cap_.reserve(edges);
+            cost_.reserve(edges);
+        }
+
+        // Returns the id of the new edge; ids are 0, 1, 2, ... in insertion order.
+        int addEdge(int from, int to, Flow capacity, Cost cost) {
+            if (from < 0 || from >= n_ || to < 0 || to >= n_) {
+                throw std::out_of_range("NetworkSimplex: edge (" + std::to_string(from) + ", " + std::to_string(to) +
+                                        ") out of range");
+            }
+            if (capacity < 0) throw std::invalid_argument("NetworkSimplex: negative capacity");
+            from_.push_back(from);
+            to_.push_back(to);
+            cap_.push_back(capacity);
+            cost_.push_back(cost);
+            return static_cast<int>(cap_.size()) - 1;
+        }
+
+        int from(int e) const { return from_[e]; }
+        int to(int e) const { return to_[e]; }
+        Flow capacity(int e) const { return cap_[e]; }
+        Cost cost(int e) const { return cost_[e]; }
+
+        // Positive supply: the vertex emits flow; negative: it absorbs flow.
+        void setSupply(int v, Flow supply) {
+            if (v < 0 || v >= n_) throw std::out_of_range("NetworkSimplex: vertex out of range");
+            supply_[v] = supply;
+        }
+
+        Flow supply(int v) const { return supply_[v]; }
+
+        // Flow on edge e after the last run.
+        Flow flow(int e) const {
+            return static_cast<std::size_t>(e) < flow_.size() && e < edgeCount() ? flow_[e] : 0;
+        }
+
+        // Optimal dual solution: c(e) + potential(from) - potential(to) >= 0 for
+        // every edge with spare capacity, <= 0 for every edge with flow. 0
+        // before the first run.
+        Cost potential(int v) const {
+            if (v < 0 || v >= n_) throw std::out_of_range("NetworkSimplex: vertex out of range");
+            return static_cast<std::size_t>(v) < pi_.size() ? pi_[v] : 0;
+        }
+
+        Cost totalCost() const {
+            Cost total = 0;
+            for (int e = 0; e < edgeCount(); ++e) total += flow_[e] * cost_[e];
+            return total;
+        }
+
+        long long pivots() const { return pivots_; }
+
+        Status run() {
+            Flow balance = 0;
+            for (Flow b : supply_) balance += b;
+            pivots_ = 0;
+            if (balance != 0) return Status::Infeasible;
+            init();
+            if (n_ == 0) return Status::Optimal;
+
+            while (findEnteringArc()) {
+                ++pivots_;
+                findJoin();
+                bool change = findLeavingArc();
+                if (delta_ >= kInf) return Status::Unbounded;
+                changeFlow(change);
+                if (change) {
+                    rehang();
+                    updatePotentials();
+                }
+            }
+            for (int e = edgeCount(); e < edgeCount() + n_; ++e) {
+                if (flow_[e] != 0) return Status::Infeasible;
+            }
+            return Status::Optimal;
+        }
+
+        // Supplies are replaced by +F at s and -F at t.
+        Result solve(int s, int t, Flow limit = kUnlimited) {
+            if (s < 0 || s >= n_ || t < 0 || t >= n_) throw std::out_of_range("NetworkSimplex: terminal out of range");
+            if (s == t) throw std::invalid_argument("NetworkSimplex: source equals sink");
+            if (limit < 0) throw std::invalid_argument("NetworkSimplex: negative flow limit");
+
+            MaxFlow maxFlow(n_);
+            maxFlow.reserve(edgeCount());
+            for (int e = 0; e < edgeCount(); ++e) maxFlow.addEdge(from_[e], to_[e], cap_[e]);
+            Flow amount = std::min(limit, maxFlow.dinic(s, t));
+
+            std::fill(supply_.begin(), supply_.end(), 0);
+            supply_[s] = amount;
+            supply_[t] = -amount;
+            if (run() != Status::Optimal) throw std::logic_error("NetworkSimplex: no optimal solution");
+            return {amount, totalCost()};
+        }
+
+    private:
+        static constexpr Flow kInf = std::numeric_limits<Flow>::max();
+        static constexpr int kUp = 1, kDown = -1;
+        static constexpr signed char kLower = 1, kTree = 0, kUpper = -1;
+
+        int n_;
+        std::vector<int> from_, to_;
+        std::vector<Flow> cap_;
+        std::vector<Cost> cost_;
+        std::vector<Flow> supply_;
+        long long pivots_ = 0;
+
+        // Arcs: user edges, then one artificial arc per vertex.
+        std::vector<int> source_, target_;
+        std::vector<Flow> arcCap_, flow_;
+        std::vector<Cost> arcCost_;
+        std::vector<signed char> state_;
+
+        // Spanning tree over the vertices and the root n.
+        int root_ = 0;
+        std::vector<int> parent_, pred_, predDir_;
+        std::vector<int> thread_, revThread_, succNum_, lastSucc_;
+        std::vector<Cost> pi_;
+
+        int blockSize_ = 0, nextArc_ = 0;
+        int inArc_ = -1, join_ = -1, uIn_ = -1, vIn_ = -1, uOut_ = -1;
+        Flow delta_ = 0;
+
+        // Scratch for rehang().
+        std::vector<int> subtree_, order_, stack_, childHead_, childNext_, posOf_;
+
+        void init() {
+            const int m = edgeCount(), all = m + n_;
+            root_ = n_;
+            source_.assign(from_.begin(), from_.end());
+            target_.assign(to_.begin(), to_.end());
+            arcCap_.assign(cap_.begin(), cap_.end());
+            arcCost_.assign(cost_.begin(), cost_.end());
+            source_.resize(all);
+            target_.resize(all);
+            arcCap_.resize(all);
+            arcCost_.resize(all);
+            flow_.assign(all, 0);
+            state_.assign(all, kLower);
+
+            parent_.assign(n_ + 1, -1);
+            pred_.assign(n_ + 1, -1);
+            predDir_.assign(n_ + 1, kUp);
+            thread_.assign(n_ + 1, 0);
+            revThread_.assign(n_ + 1, 0);
+            succNum_.assign(n_ + 1, 1);
+            lastSucc_.assign(n_ + 1, 0);
+            pi_.assign(n_ + 1, 0);
+            childHead_.assign(n_ + 1, -1);
+            childNext_.assign(n_ + 1, -1);
+            posOf_.assign(n_ + 1, 0);
+
+            Cost maxCost = 0;
+            for (Cost c : cost_) maxCost = std::max(maxCost, c < 0 ? -c : c);
+            const Cost bigM = (maxCost + 1) * (n_ + 1);
+
+            thread_[root_] = 0;
+            revThread_[0] = root_;
+            succNum_[root_] = n_ + 1;
+            lastSucc_[root_] = n_ - 1;
+            for (int u = 0, e = m; u < n_; ++u, ++e) {
+                parent_[u] = root_;
+                pred_[u] = e;
+                thread_[u] = u + 1;
+                revThread_[u + 1] = u;
+                lastSucc_[u] = u;
+                arcCap_[e] = kInf;
+                state_[e] = kTree;
+                if (supply_[u] >= 0) {
+                    predDir_[u] = kUp;
+                    source_[e] = u;
+                    target_[e] = root_;
+                    flow_[e] = supply_[u];
+                    arcCost_[e] = 0;
+                } else {
+                    predDir_[u] = kDown;
+                    pi_[u] = bigM;
+                    source_[e] = root_;
+                    target_[e] = u;
+                    flow_[e] = -supply_[u];
+                    arcCost_[e] = bigM;
+                }
+            }
+
+            blockSize_ = std::max(10, static_cast<int>(std::sqrt(static_cast<double>(m))));
+            nextArc_ = 0;
+        }
+
+        Cost reducedCost(int e) const { return arcCost_[e] + pi_[source_[e]] - pi_[target_[e]]; }
+
+        // Block search over the user arcs; artificial arcs never re-enter.
+        bool findEnteringArc() {
+            const int m = edgeCount();
+            if (m == 0) return false;
+            Cost best = 0;
+            int count = blockSize_;
+            for (int i = 0, e = nextArc_; i < m; ++i) {
+                Cost c = state_[e] * reducedCost(e);
+                if (c < best) {
+                    best = c;
+                    inArc_ = e;
+                }
+                if (++e == m) e = 0;
+                if (--count == 0) {
+                    if (best < 0) {
+                        nextArc_ = e;
+                        return true;
+                    }
+                    count = blockSize_;
+                }
+            }
+            if (best >= 0) return false;
+            nextArc_ = inArc_;
+            return true;
+        }
+
+        void findJoin() {
+            int u = source_[inArc_], v = target_[inArc_];
+            while (u != v) {
+                if (succNum_[u] < succNum_[v]) u = parent_[u];
+                else v = parent_[v];
+            }
+            join_ = u;
+        }
+
+        // Returns false when the entering arc itself limits the cycle.
+        bool findLeavingArc() {
+            int first, second;
+            if (state_[inArc_] == kLower) {
+                first = source_[inArc_];
+                second = target_[inArc_];
+            } else {
+                first = target_[inArc_];
+                second = source_[inArc_];
+            }
+            delta_ = arcCap_[inArc_];
+            int result = 0;
+            for (int u = first; u != join_; u = parent_[u]) {
+                int e = pred_[u];
+                Flow d = predDir_[u] == kDown ? residual(e) : flow_[e];
+                if (d < delta_) {
+                    delta_ = d;
+                    uOut_ = u;
+                    result = 1;
+                }
+            }
+            for (int u = second; u != join_; u = parent_[u]) {
+                int e = pred_[u];
+                Flow d = predDir_[u] == kUp ? residual(e) : flow_[e];
+                if (d <= delta_) {
+                    delta_ = d;
+                    uOut_ = u;
+                    result = 2;
+                }
+            }
+            if (result == 1) {
+                uIn_ = first;
+                vIn_ = second;
+            } else {
+                uIn_ = second;
+                vIn_ = first;
+            }
+            return result != 0;
+        }
+
+        Flow residual(int e) const { return arcCap_[e] == kInf ? kInf : arcCap_[e] - flow_[e]; }
+
+        void changeFlow(bool change) {
+            if (delta_ > 0) {
+                Flow val = state_[inArc_] * delta_;
+                flow_[inArc_] += val;
+                for (int u = source_[inArc_]; u != join_; u = parent_[u]) flow_[pred_[u]] -= predDir_[u] * val;
+                for (int u = target_[inArc_]; u != join_; u = parent_[u]) flow_[pred_[u]] += predDir_[u] * val;
+            }
+            if (change) {
+                state_[inArc_] = kTree;
+                state_[pred_[uOut_]] = flow_[pred_[uOut_]] == 0 ? kLower : kUpper;
+            } else {
+                state_[inArc_] = static_cast<signed char>(-state_[inArc_]);
+            }
+        }
+
+        // Replace pred(uOut) by the entering arc: cut the subtree S of uOut,
+        // re-root it at uIn, hang it below vIn and rebuild its preorder.
+        void rehang() {
+            const int vOut = parent_[uOut_];
+            const int size = succNum_[uOut_];
+            const int oldLast = lastSucc_[uOut_];
+
+            subtree_.clear();
+            for (int x = uOut_, i = 0; i < size; ++i, x = thread_[x]) subtree_.push_back(x);
+
+            // Cut S out of the thread and out of the subtrees above it.
+            const int before = revThread_[uOut_], after = thread_[oldLast];
+            thread_[before] = after;
+            revThread_[after] = before;
+            for (int a = vOut; a != join_; a = parent_[a]) succNum_[a] -= size;
+            for (int a = vOut; a != -1 && lastSucc_[a] == oldLast; a = parent_[a]) lastSucc_[a] = before;
+
+            // Reverse the stem uIn .. uOut.
+            int x = uIn_, newParent = vIn_, newPred = inArc_;
+            int newDir = uIn_ == source_[inArc_] ? kUp : kDown;
+            for (;;) {
+                int oldParent = parent_[x], oldPred = pred_[x], oldDir = predDir_[x];
+                parent_[x] = newParent;
+                pred_[x] = newPred;
+                predDir_[x] = newDir;
+                if (x == uOut_) break;
+                newParent = x;
+                newPred = oldPred;
+                newDir = -oldDir;
+                x = oldParent;
+            }
+
+            // Preorder of S from uIn.
+            for (int y : subtree_) childHead_[y] = -1;
+            for (int y : subtree_) {
+                if (y == uIn_) continue;
+                childNext_[y] = childHead_[parent_[y]];
+                childHead_[parent_[y]] = y;
+            }
+            order_.clear();
+            stack_.assign(1, uIn_);
+            while (!stack_.empty()) {
+                int y = stack_.back();
+                stack_.pop_back();
+                posOf_[y] = static_cast<int>(order_.size());
+                order_.push_back(y);
+                succNum_[y] = 1;
+                for (int c = childHead_[y]; c != -1; c = childNext_[c]) stack_.push_back(c);
+            }
+            for (int i = size - 1; i > 0; --i) succNum_[parent_[order_[i]]] += succNum_[order_[i]];
+            for (int y : order_) lastSucc_[y] = order_[posOf_[y] + succNum_[y] - 1];
+
+            // Splice S into the thread right after vIn.
+            const int next = thread_[vIn_];
+            thread_[vIn_] = order_[0];
+            revThread_[order_[0]] = vIn_;
+            for (int i = 0; i + 1 < size; ++i) {
+                thread_[order_[i]] = order_[i + 1];
+                revThread_[order_[i + 1]] = order_[i];
+            }
+            thread_[order_.back()] = next;
+            revThread_[next] = order_.back();
+
+            for (int a = vIn_; a != join_; a = parent_[a]) succNum_[a] += size;
+            for (int a = vIn_; a != -1 && lastSucc_[a] == vIn_; a = parent_[a]) lastSucc_[a] = order_.back();
+        }
+
+        // Make the entering arc's reduced cost zero by shifting the potentials of S.
+        void updatePotentials() {
+            Cost sigma = pi_[vIn_] - pi_[uIn_] - predDir_[uIn_] * arcCost_[inArc_];
+            for (int y : order_) pi_[y] += sigma;
+        }
+    };
+
+} // namespace algo
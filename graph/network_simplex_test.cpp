@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "graph/min_cost_flow.hpp"
+#include "graph/network_simplex.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    struct Arc {
+        int from, to;
+        long long cap, cost;
+    };
+
+    struct Network {
+        int n, s, t;
+        vector<Arc> arcs;
+    };
+
+    // Random network with some negative costs but no negative cycle:
+    // cost(u, v) = c' - p(u) + p(v) with c' >= 0.
+    Network randomNetwork(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        vector<long long> p(n);
+        for (auto& x : p) x = rng() % 40;
+        Network net{n, 0, n - 1, {}};
+        for (int i = 0; i < m; i++) {
+            int u = rng() % n, v = rng() % n;
+            net.arcs.push_back({u, v, (long long) (rng() % 20), (long long) (rng() % 30) - p[u] + p[v]});
+        }
+        return net;
+    }
+
+    template<typename Solver>
+    Solver build(const Network& net) {
+        Solver solver(net.n);
+        for (const Arc& a : net.arcs) solver.addEdge(a.from, a.to, a.cap, a.cost);
+        return solver;
+    }
+
+    // Capacity limits, the given vertex balances and the reported cost.
+    void expectValidFlow(const algo::NetworkSimplex& ns, const vector<long long>& supply, long long cost) {
+        vector<long long> balance(ns.size(), 0);
+        long long total = 0;
+        for (int e = 0; e < ns.edgeCount(); e++) {
+            ASSERT_GE(ns.flow(e), 0);
+            ASSERT_LE(ns.flow(e), ns.capacity(e));
+            balance[ns.from(e)] += ns.flow(e);
+            balance[ns.to(e)] -= ns.flow(e);
+            total += ns.flow(e) * ns.cost(e);
+        }
+        EXPECT_EQ(total, cost);
+        for (int v = 0; v < ns.size(); v++) EXPECT_EQ(balance[v], supply[v]) << "vertex " << v;
+    }
+
+    // Complementary slackness against the returned potentials.
+    void expectOptimalDuals(const algo::NetworkSimplex& ns) {
+        for (int e = 0; e < ns.edgeCount(); e++) {
+            long long reduced = ns.cost(e) + ns.potential(ns.from(e)) - ns.potential(ns.to(e));
+            if (ns.flow(e) < ns.capacity(e)) {
+                EXPECT_GE(reduced, 0) << "edge " << e;
+            }
+            if (ns.flow(e) > 0) {
+                EXPECT_LE(reduced, 0) << "edge " << e;
+            }
+        }
+    }
+}
+
+TEST(NetworkSimplexTest, MatchesMinCostFlow) {
+    for (unsigned seed = 1; seed <= 30; seed++) {
+        auto net = randomNetwork(10 + seed % 20, 50 + seed * 5, seed);
+        auto mcf = build<algo::MinCostFlow>(net);
+        auto ns = build<algo::NetworkSimplex>(net);
+
+        auto expected = mcf.solve(net.s, net.t);
+        auto r = ns.solve(net.s, net.t);
+        EXPECT_EQ(r.flow, expected.flow);
+        EXPECT_EQ(r.cost, expected.cost);
+        vector<long long> supply(net.n, 0);
+        supply[net.s] = r.flow;
+        supply[net.t] = -r.flow;
+        expectValidFlow(ns, supply, r.cost);
+        expectOptimalDuals(ns);
+
+        long long limit = expected.flow / 3;
+        auto partial = ns.solve(net.s, net.t, limit);
+        auto expectedPartial = mcf.solve(net.s, net.t, limit);
+        EXPECT_EQ(partial.flow, expectedPartial.flow);
+        EXPECT_EQ(partial.cost, expectedPartial.cost);
+    }
+}
+
+TEST(NetworkSimplexTest, TransportationProblemWithLargeSupplies) {
+    // Supplies in the millions: MinCostFlow needs a super source and sink,
+    // the simplex takes the supplies directly.
+    const int left = 40, right = 35;
+    mt19937 rng(9);
+    algo::NetworkSimplex ns(left + right);
+    algo::MinCostFlow mcf(left + right + 2);
+    const int s = left + right, t = s + 1;
+    vector<long long> supply(left + right, 0);
+    long long total = 0;
+    for (int i = 0; i < left; i++) {
+        supply[i] = rng() % 1000000 + 1;
+        total += supply[i];
+    }
+    long long remaining = total;
+    for (int j = 0; j < right; j++) {
+        long long d = j + 1 == right ? remaining : remaining / (right - j) + (long long) (rng() % 1000);
+        d = min(d, remaining);
+        supply[left + j] = -d;
+        remaining -= d;
+    }
+    for (int v = 0; v < left + right; v++) ns.setSupply(v, supply[v]);
+    for (int i = 0; i < left; i++) mcf.addEdge(s, i, supply[i], 0);
+    for (int j = 0; j < right; j++) mcf.addEdge(left + j, t, -supply[left + j], 0);
+    for (int i = 0; i < left; i++) {
+        for (int j = 0; j < right; j++) {
+            long long cost = rng() % 1000;
+            ns.addEdge(i, left + j, algo::NetworkSimplex::kUnlimited / 4, cost);
+            mcf.addEdge(i, left + j, total, cost);
+        }
+    }
+
+    ASSERT_EQ(ns.run(), algo::NetworkSimplex::Status::Optimal);
+    auto expected = mcf.solve(s, t);
+    EXPECT_EQ(expected.flow, total);
+    EXPECT_EQ(ns.totalCost(), expected.cost);
+    expectValidFlow(ns, supply, expected.cost);
+    expectOptimalDuals(ns);
+    EXPECT_GT(ns.pivots(), 0);
+}
+
+TEST(NetworkSimplexTest, NegativeCyclesAreSaturated) {
+    algo::NetworkSimplex ns(3);
+    int a = ns.addEdge(0, 1, 4, -3);
+    int b = ns.addEdge(1, 2, 6, 1);
+    int c = ns.addEdge(2, 0, 5, 1);
+    ASSERT_EQ(ns.run(), algo::NetworkSimplex::Status::Optimal);
+    EXPECT_EQ(ns.flow(a), 4);
+    EXPECT_EQ(ns.flow(b), 4);
+    EXPECT_EQ(ns.flow(c), 4);
+    EXPECT_EQ(ns.totalCost(), -4);
+}
+
+TEST(NetworkSimplexTest, InfeasibleSupplies) {
+    algo::NetworkSimplex ns(3);
+    ns.addEdge(0, 1, 2, 1);
+    ns.setSupply(0, 3);
+    ns.setSupply(1, -3);
+    EXPECT_EQ(ns.run(), algo::NetworkSimplex::Status::Infeasible);
+    ns.setSupply(1, -2);
+    EXPECT_EQ(ns.run(), algo::NetworkSimplex::Status::Infeasible);
+    ns.setSupply(0, 2);
+    EXPECT_EQ(ns.run(), algo::NetworkSimplex::Status::Optimal);
+    EXPECT_EQ(ns.totalCost(), 2);
+}
+
+TEST(NetworkSimplexTest, InvalidInput) {
+    algo::NetworkSimplex ns(4);
+    EXPECT_EQ(ns.potential(3), 0);
+    EXPECT_THROW(ns.potential(4), std::out_of_range);
+    EXPECT_THROW(ns.addEdge(0, 4, 1, 1), std::out_of_range);
+    EXPECT_THROW(ns.addEdge(0, 1, -1, 1), std::invalid_argument);
+    EXPECT_THROW(ns.setSupply(4, 1), std::out_of_range);
+    EXPECT_THROW(ns.solve(0, 0), std::invalid_argument);
+    EXPECT_THROW(ns.solve(0, 3, -1), std::invalid_argument);
+    EXPECT_EQ(ns.solve(0, 3).flow, 0);
+}
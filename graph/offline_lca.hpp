@@ -0,0 +1,87 @@
+#pragma once
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data_structure/disjoint_set.hpp"
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Offline LCA of a whole batch of queries by Tarjan's algorithm, in
+    // O((n + q) alpha(n)) with no per-query random access into jump tables.
+    //
+    // The queries are bucketed per endpoint with a counting sort. One
+    // iterative DFS from `root` then visits every vertex once: when u is
+    // finished its subtree is merged into u's set in algo::DisjointSet, and
+    // every query (u, w) whose other end w is already finished is answered
+    // with the current ancestor of w's set.
+    //
+    // Tree: std::vector<std::vector<int>> adjacency or an undirected
+    // CsrGraph. answers[i] is the LCA of queries[i], or -1 when an endpoint
+    // is not in root's component. A cycle or a repeated edge in root's
+    // component throws std::invalid_argument.
+    template <typename Tree>
+    std::vector<int> lcaBatch(const Tree& tree, int root, std::span<const std::pair<int, int>> queries) {
+        const int n = static_cast<int>(tree.size());
+        if (root < 0 || root >= n) throw std::out_of_range("lcaBatch: root out of range");
+        const std::size_t q = queries.size();
+
+        std::vector<std::size_t> offsets(n + 1, 0);
+        for (auto [u, v] : queries) {
+            if (u < 0 || u >= n || v < 0 || v >= n) {
+                throw std::out_of_range("lcaBatch: query (" + std::to_string(u) + ", " + std::to_string(v) +
+                                        ") out of range");
+            }
+            ++offsets[u + 1];
+            ++offsets[v + 1];
+        }
+        for (int u = 0; u < n; ++u) offsets[u + 1] += offsets[u];
+        std::vector<std::size_t> bucket(2 * q), cursor(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < q; ++i) {
+            bucket[cursor[queries[i].first]++] = i;
+            bucket[cursor[queries[i].second]++] = i;
+        }
+
+        std::vector<int> answers(q, -1);
+        DisjointSet dsu(n);
+        std::vector<int> ancestor(n + 1), parent(n, -1);
+        std::vector<char> finished(n, 0);
+
+        // Frames are (vertex, index of the next neighbour to look at).
+        std::vector<std::pair<int, std::size_t>> stack = {{root, 0}};
+        parent[root] = root;
+        ancestor[root] = root;
+        while (!stack.empty()) {
+            auto& [u, next] = stack.back();
+            const auto& adj = neighbors(tree, u);
+            if (next < adj.size()) {
+                int v = adj[next++];
+                if (v == parent[u] || v == u) continue;
+                if (parent[v] != -1) throw std::invalid_argument("lcaBatch: input has a cycle");
+                parent[v] = u;
+                ancestor[v] = v;
+                stack.push_back({v, 0});
+                continue;
+            }
+
+            finished[u] = 1;
+            for (std::size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                std::size_t i = bucket[k];
+                int w = queries[i].first == u ? queries[i].second : queries[i].first;
+                if (finished[w]) answers[i] = ancestor[dsu.find(w)];
+            }
+            int p = parent[u], done = u;
+            stack.pop_back();
+            if (done != root) {
+                dsu.merge(p, done);
+                ancestor[dsu.find(p)] = p;
+            }
+        }
+        return answers;
+    }
+
+} // namespace algo
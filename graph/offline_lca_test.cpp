@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "graph/lca.hpp"
+#include "graph/offline_lca.hpp"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+TEST(OfflineLcaTest, MatchesOnlineLca) {
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        mt19937 rng(seed);
+        int n = 1 + seed * 211;
+        vector<vector<int>> adj(n);
+        for (int i = 1; i < n; i++) {
+            int p = seed % 2 ? (int) (rng() % i) : max(0, i - 1 - (int) (rng() % 3));
+            adj[i].push_back(p);
+            adj[p].push_back(i);
+        }
+        int root = rng() % n;
+        vector<pair<int, int>> queries(5000);
+        for (auto& [u, v] : queries) {
+            u = rng() % n;
+            v = rng() % 4 == 0 ? u : (int) (rng() % n);
+        }
+
+        algo::Lca online(adj, root, algo::Lca::Backend::EulerRmq);
+        auto answers = algo::lcaBatch(adj, root, queries);
+        ASSERT_EQ(answers.size(), queries.size());
+        for (size_t i = 0; i < queries.size(); i++) {
+            ASSERT_EQ(answers[i], online.lca(queries[i].first, queries[i].second)) << "query " << i;
+        }
+    }
+}
+
+TEST(OfflineLcaTest, DeepCsrTree) {
+    // A 300k-vertex path: an iterative DFS is required.
+    const int n = 300000;
+    vector<algo::CsrGraph<int>::Edge> edges;
+    for (int i = 1; i < n; i++) edges.push_back({i - 1, i, 1});
+    algo::CsrGraph<int> g(n, edges, {.undirected = true});
+    vector<pair<int, int>> queries = {{0, n - 1}, {n - 1, 7}, {n / 2, n / 2}, {12, 11}};
+    auto answers = algo::lcaBatch(g, 0, queries);
+    EXPECT_EQ(answers, (vector<int>{0, 7, n / 2, 11}));
+}
+
+TEST(OfflineLcaTest, ForestAndInvalidInput) {
+    // 0-1-2 and 3-4: queries across components have no answer.
+    vector<vector<int>> adj = {{1}, {0, 2}, {1}, {4}, {3}};
+    vector<pair<int, int>> queries = {{2, 0}, {3, 4}, {2, 4}, {1, 1}};
+    EXPECT_EQ(algo::lcaBatch(adj, 1, queries), (vector<int>{1, -1, -1, 1}));
+    EXPECT_TRUE(algo::lcaBatch(adj, 0, {}).empty());
+
+    vector<pair<int, int>> bad = {{0, 5}};
+    EXPECT_THROW(algo::lcaBatch(adj, 0, bad), std::out_of_range);
+    EXPECT_THROW(algo::lcaBatch(adj, 5, queries), std::out_of_range);
+
+    vector<vector<int>> cycle = {{1, 2}, {0, 3}, {0, 3}, {1, 2}};
+    EXPECT_THROW(algo::lcaBatch(cycle, 0, {}), std::invalid_argument);
+    vector<vector<int>> repeated = {{1, 1}, {0, 0, 2}, {1}};
+    EXPECT_THROW(algo::lcaBatch(repeated, 0, {}), std::invalid_argument);
+}
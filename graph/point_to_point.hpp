@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "data_structure/indexed_heap.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/dijkstra.hpp"
+
+namespace algo {
+
+    // Lower bound heuristics for A*. lowerBound(u, v) must never exceed the
+    // true distance from u to v and must satisfy the triangle inequality
+    // (consistency), which both of these do.
+
+    struct ZeroHeuristic {
+        long long lowerBound(int, int) const { return 0; }
+    };
+
+    // ALT (A*, landmarks, triangle inequality). For every landmark L the
+    // distances d(L, *) and d(*, L) are precomputed, and
+    //   d(u, v) >= max(d(L, v) - d(L, u), d(u, L) - d(v, L)).
+    class AltHeuristic {
+    public:
+        template <typename W>
+        AltHeuristic(const CsrGraph<W>& g, const CsrGraph<W>& reverse, const std::vector<int>& landmarks) {
+            Dijkstra dijkstra(g.size());
+            for (int l : landmarks) {
+                dijkstra.run(g, l);
+                from_.emplace_back(dijkstra.distances().begin(), dijkstra.distances().begin() + g.size());
+                dijkstra.run(reverse, l);
+                to_.emplace_back(dijkstra.distances().begin(), dijkstra.distances().begin() + g.size());
+            }
+        }
+
+        // Farthest-point landmark selection: start from `first`, then keep
+        // adding the reachable vertex farthest from all chosen landmarks.
+        template <typename W>
+        static std::vector<int> selectLandmarks(const CsrGraph<W>& g, int count, int first = 0) {
+            std::vector<int> chosen;
+            if (g.size() == 0 || count <= 0) return chosen;
+            std::vector<long long> nearest(g.size(), Dijkstra::kInfinity);
+            Dijkstra dijkstra(g.size());
+            int next = first;
+            while (static_cast<int>(chosen.size()) < count && next >= 0) {
+                chosen.push_back(next);
+                dijkstra.run(g, next);
+                next = -1;
+                for (int v = 0; v < g.size(); ++v) {
+                    nearest[v] = std::min(nearest[v], dijkstra.distance(v));
+                    if (nearest[v] != Dijkstra::kInfinity && nearest[v] > 0 &&
+                        (next == -1 || nearest[v] > nearest[next])) next = v;
+                }
+            }
+            return chosen;
+        }
+
+        long long lowerBound(int u, int v) const {
+            constexpr long long inf = Dijkstra::kInfinity;
+            long long best = 0;
+            for (std::size_t l = 0; l < from_.size(); ++l) {
+                if (from_[l][u] != inf && from_[l][v] != inf) best = std::max(best, from_[l][v] - from_[l][u]);
+                if (to_[l][u] != inf && to_[l][v] != inf) best = std::max(best, to_[l][u] - to_[l][v]);
+            }
+            return best;
+        }
+
+        int landmarks() const { return static_cast<int>(from_.size()); }
+
+    private:
+        std::vector<std::vector<long long>> from_, to_;
+    };
+
+    // Point-to-point shortest path queries on a static graph with
+    // non-negative integer weights. Every search stops as soon as the s -> t distance
+    // is proven instead of settling the whole graph.
+    //
+    //   bidirectionalDijkstra(s, t)   : forward from s and backward from t,
+    //                                   stop when top_f + top_b >= best.
+    //   astar(s, t, h)                : key d(v) + h(v, t).
+    //   bidirectionalAstar(s, t, h)   : symmetric average potentials
+    //                                   p(v) = (h(v, t) - h(s, v)) / 2 in both
+    //                                   directions; keys are kept doubled so
+    //                                   they stay integral.
+    //
+    // The graph is referenced, not copied, and must outlive the engine. Negative
+    // weights are rejected once, at construction. Workspaces are reused between
+    // queries and reset only where touched.
+    template <typename W>
+    class PointToPoint {
+        static_assert(std::is_integral_v<W>, "PointToPoint needs integer weights.");
+
+    public:
+        using Distance = long long;
+        static constexpr Distance kInfinity = Dijkstra::kInfinity;
+
+        explicit PointToPoint(const CsrGraph<W>& g)
+            : g_(g), reverse_(g.transposed()), forward_(g.size()), backward_(g.size()) {
+            if constexpr (std::is_signed_v<W>) {
+                for (const W& w : g.weights()) {
+                    if (w < 0) throw std::invalid_argument("PointToPoint: negative edge weight");
+                }
+            }
+        }
+
+        const CsrGraph<W>& reverseGraph() const { return reverse_; }
+
+        // Vertices settled by the last query, both directions together.
+        long long settled() const { return settled_; }
+
+        Distance bidirectionalDijkstra(int s, int t) {
+            return bidirectional(s, t, ZeroHeuristic{});
+        }
+
+        template <typename Heuristic>
+        Distance astar(int s, int t, const Heuristic& h) {
+            check(s, t);
+            forward_.reset();
+            settled_ = 0;
+
+            forward_.set(s, 0);
+            forward_.heap.push(s, h.lowerBound(s, t));
+            while (!forward_.heap.empty()) {
+                int u = forward_.heap.pop();
+                ++settled_;
+                if (u == t) return forward_.dist[t];
+                for (auto [v, w] : g_[u]) {
+                    Distance nd = forward_.dist[u] + static_cast<Distance>(w);
+                    if (nd >= forward_.dist[v]) continue;
+                    forward_.set(v, nd);
+                    forward_.heap.update(v, nd + h.lowerBound(v, t));
+                }
+            }
+            return kInfinity;
+        }
+
+        template <typename Heuristic>
+        Distance bidirectionalAstar(int s, int t, const Heuristic& h) {
+            return bidirectional(s, t, h);
+        }
+
+    private:
+        struct Side {
+            std::vector<Distance> dist;
+            std::vector<int> touched;
+            IndexedHeap<Distance> heap;
+
+            explicit Side(int n) : dist(n, kInfinity), heap(n) {}
+
+            void set(int v, Distance d) {
+                if (dist[v] == kInfinity) touched.push_back(v);
+                dist[v] = d;
+            }
+
+            void reset() {
+                for (int v : touched) dist[v] = kInfinity;
+                touched.clear();
+                heap.reset();
+            }
+        };
+
+        const CsrGraph<W>& g_;
+        CsrGraph<W> reverse_;
+        Side forward_, backward_;
+        long long settled_ = 0;
+
+        void check(int s, int t) const {
+            if (s < 0 || s >= g_.size() || t < 0 || t >= g_.size()) {
+                throw std::out_of_range("PointToPoint: vertex out of range");
+            }
+        }
+
+        template <typename Heuristic>
+        Distance bidirectional(int s, int t, const Heuristic& h) {
+            check(s, t);
+            forward_.reset();
+            backward_.reset();
+            settled_ = 0;
+
+            // Doubled forward potential; the backward one is its negation.
+            auto potential = [&](int v) { return h.lowerBound(v, t) - h.lowerBound(s, v); };
+
+            Distance best = s == t ? 0 : kInfinity;
+            forward_.set(s, 0);
+            forward_.heap.push(s, potential(s));
+            backward_.set(t, 0);
+            backward_.heap.push(t, -potential(t));
+
+            while (!forward_.heap.empty() && !backward_.heap.empty()) {
+                if (best != kInfinity && forward_.heap.topKey() + backward_.heap.topKey() >= 2 * best) break;
+
+                bool goForward = forward_.heap.topKey() <= backward_.heap.topKey();
+                Side& self = goForward ? forward_ : backward_;
+                Side& other = goForward ? backward_ : forward_;
+                const CsrGraph<W>& graph = goForward ? g_ : reverse_;
+                const int sign = goForward ? 1 : -1;
+
+                int u = self.heap.pop();
+                ++settled_;
+                for (auto [v, w] : graph[u]) {
+                    Distance nd = self.dist[u] + static_cast<Distance>(w);
+                    if (other.dist[v] != kInfinity) best = std::min(best, nd + other.dist[v]);
+                    if (nd >= self.dist[v]) continue;
+                    self.set(v, nd);
+                    self.heap.update(v, 2 * nd + sign * potential(v));
+                }
+            }
+            return best;
+        }
+    };
+
+} // namespace algo
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "graph/csr_graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/point_to_point.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // Grid-like road network with random weights plus a few shortcuts.
+    algo::CsrGraph<int> roadGraph(int side, unsigned seed) {
+        mt19937 rng(seed);
+        vector<algo::CsrGraph<int>::Edge> edges;
+        auto id = [&](int r, int c) { return r * side + c; };
+        for (int r = 0; r < side; r++) {
+            for (int c = 0; c < side; c++) {
+                if (c + 1 < side) {
+                    edges.push_back({id(r, c), id(r, c + 1), (int) (rng() % 100 + 1)});
+                    edges.push_back({id(r, c + 1), id(r, c), (int) (rng() % 100 + 1)});
+                }
+                if (r + 1 < side) {
+                    edges.push_back({id(r, c), id(r + 1, c), (int) (rng() % 100 + 1)});
+                    edges.push_back({id(r + 1, c), id(r, c), (int) (rng() % 100 + 1)});
+                }
+            }
+        }
+        for (int i = 0; i < side; i++) {
+            edges.push_back({(int) (rng() % (side * side)), (int) (rng() % (side * side)), (int) (rng() % 500)});
+        }
+        return algo::CsrGraph<int>(side * side, edges);
+    }
+}
+
+TEST(PointToPointTest, AllMethodsMatchDijkstra) {
+    auto g = roadGraph(30, 1);
+    algo::PointToPoint<int> p2p(g);
+    algo::AltHeuristic alt(g, p2p.reverseGraph(), algo::AltHeuristic::selectLandmarks(g, 4));
+    EXPECT_EQ(alt.landmarks(), 4);
+
+    algo::Dijkstra dijkstra;
+    mt19937 rng(2);
+    for (int q = 0; q < 40; q++) {
+        int s = rng() % g.size(), t = rng() % g.size();
+        dijkstra.run(g, s);
+        long long expected = dijkstra.distance(t);
+
+        EXPECT_EQ(p2p.bidirectionalDijkstra(s, t), expected);
+        EXPECT_EQ(p2p.astar(s, t, algo::ZeroHeuristic{}), expected);
+        EXPECT_EQ(p2p.astar(s, t, alt), expected);
+        EXPECT_EQ(p2p.bidirectionalAstar(s, t, alt), expected);
+        EXPECT_EQ(p2p.bidirectionalAstar(s, t, algo::ZeroHeuristic{}), expected);
+    }
+}
+
+TEST(PointToPointTest, AltSettlesFewerVertices) {
+    auto g = roadGraph(40, 3);
+    algo::PointToPoint<int> p2p(g);
+    algo::AltHeuristic alt(g, p2p.reverseGraph(), algo::AltHeuristic::selectLandmarks(g, 8));
+
+    long long plain = 0, guided = 0;
+    for (int q = 0; q < 20; q++) {
+        int s = q * 37 % g.size(), t = (q * 91 + 500) % g.size();
+        p2p.bidirectionalDijkstra(s, t);
+        plain += p2p.settled();
+        p2p.bidirectionalAstar(s, t, alt);
+        guided += p2p.settled();
+    }
+    EXPECT_LT(guided, plain);
+}
+
+TEST(PointToPointTest, UnreachableAndTrivial) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 5}, {1, 2, 5}};
+    algo::CsrGraph<int> g(4, edges);
+    algo::PointToPoint<int> p2p(g);
+
+    EXPECT_EQ(p2p.bidirectionalDijkstra(0, 2), 10);
+    EXPECT_EQ(p2p.bidirectionalDijkstra(2, 0), algo::PointToPoint<int>::kInfinity);
+    EXPECT_EQ(p2p.astar(0, 3, algo::ZeroHeuristic{}), algo::PointToPoint<int>::kInfinity);
+    EXPECT_EQ(p2p.bidirectionalDijkstra(1, 1), 0);
+    EXPECT_THROW(p2p.bidirectionalDijkstra(0, 4), std::out_of_range);
+}
+
+TEST(PointToPointTest, RejectsNegativeWeights) {
+    vector<algo::CsrGraph<int>::Edge> edges = {{0, 1, 5}, {1, 2, -1}};
+    algo::CsrGraph<int> g(3, edges);
+    EXPECT_THROW(algo::PointToPoint<int>{g}, std::invalid_argument);
+}
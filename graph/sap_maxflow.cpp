@@ -3,6 +3,8 @@
 
 using namespace std;
 
+// For CsrGraph input use algo::MaxFlow (max_flow.hpp), which builds its
+// residual arcs straight from the CSR arrays.
 class Sap {
 public:
     const int oo = 1 << 30;
@@ -38,7 +40,7 @@ public:
                 e.f -= tmp;
                 G[e.t][e.op].f += tmp;
                 ret += tmp;
-                if (flow == ret) return ret;
+                if (flow == ret || d[S] >= n) return ret;
             }
         }
         if (!--vd[d[u]]) d[S]=n;
@@ -48,8 +50,8 @@ public:
 
     int calculate() {
         d.resize(n);
-        vd.resize(n);
-        vd[S] = n;
+        vd.resize(n + 1); // heights reach n once S is cut off
+        vd[0] = n;
         int ans = 0;
 
         while (d[S] < n) ans += dfs(S, oo);
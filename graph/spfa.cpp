@@ -1,17 +1,19 @@
 #include <iostream>
 #include <vector>
 #include <queue>
-#include <deque>
+
+#include "graph/csr_graph.hpp"
 
 using namespace std;
 
 /// @brief Implements the queue optimized Bellman-Ford algorithm to find the shortest paths in a graph.
 /// @param G The graph represented as an adjacency list where G[u] is a vector of pairs (v, d),
-///          indicating a directed edge from u to v with weight d.
+///          indicating a directed edge from u to v with weight d, or an algo::CsrGraph<int>.
 /// @param ret A vector to store the computed shortest distances from the source vertex 's' to all other vertices.
 /// @param s The source vertex from which shortest paths are calculated.
 /// @param n The total number of vertices in the graph.
-void spfa(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n) {
+template <typename Graph>
+void spfa(const Graph &G, vector<int> &ret, int s, int n) {
     queue<int> q;
     vector<char> inqueue(n, 0);
     inqueue[s] = 1;
@@ -26,7 +28,7 @@ void spfa(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n) {
         q.pop();
         inqueue[u] = 0;
 
-        for (auto &next : G[u]) {
+        for (auto next : G[u]) {
             int v = next.first, d = next.second;
             if (ret[v] == -1 || ret[v] > ret[u] + d) {
                 ret[v] = ret[u] + d;
@@ -39,11 +41,13 @@ void spfa(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s, int n) {
     }
 }
 
-inline void spfa(vector<vector<pair<int, int>>> &G, vector<int> &ret, int s) {
+template <typename Graph>
+inline void spfa(const Graph &G, vector<int> &ret, int s) {
     spfa(G, ret, s, G.size());
 }
 
-inline void spfa(vector<vector<pair<int, int>>> &G, vector<int> &ret) {
+template <typename Graph>
+inline void spfa(const Graph &G, vector<int> &ret) {
     spfa(G, ret, 0, G.size());
 }
 
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+#include "misc/thread_pool.hpp"
+
+namespace algo {
+
+    // Single-source shortest paths with arbitrary (also negative) weights,
+    // 64-bit distances, and negative cycle detection with early exit.
+    //
+    // run(G, s) is queue-based Bellman-Ford (SPFA). Order:
+    //   Fifo   : plain FIFO queue.
+    //   Slf    : Small Label First, a vertex goes to the front of the deque
+    //            when its distance is below the front's.
+    //   SlfLll : SLF plus Large Label Last, the front is rotated to the back
+    //            while its distance exceeds the queue average.
+    //
+    // runParallel(g, s, pool) is frontier-based Bellman-Ford: every round
+    // relaxes the out-arcs of all vertices improved in the previous round on
+    // the pool, with an atomic fetch-min per arc.
+    //
+    // A negative cycle reachable from s is detected two ways: the number of
+    // arcs on the path behind a label reaching n, and a check for a cycle in
+    // the predecessor graph, run after every n relaxations (every few rounds
+    // in parallel mode). Any such cycle is negative, and it is returned in arc
+    // order by negativeCycle(). Distances are meaningless in that case.
+    //
+    // Graph is anything with G.size() and `for (auto [v, w] : G[u])`.
+    class Spfa {
+    public:
+        using Distance = long long;
+        static constexpr Distance kInfinity = std::numeric_limits<Distance>::max();
+
+        enum class Order { Fifo, Slf, SlfLll };
+
+        explicit Spfa(Order order = Order::Fifo) : order_(order) {}
+
+        // Returns false when a negative cycle is reachable from s.
+        template <typename Graph>
+        bool run(const Graph& G, int s) {
+            const int n = static_cast<int>(G.size());
+            start(n, s);
+            inQueue_.assign(n, 0);
+            length_.assign(n, 0);
+            queue_.clear();
+            queueSum_ = 0;
+            enqueue(s);
+
+            long long sinceCheck = 0;
+            while (!queue_.empty()) {
+                int u = dequeue();
+                ++iterations_;
+                for (auto [v, w] : G[u]) {
+                    ++relaxations_;
+                    Distance nd = dist_[u] + static_cast<Distance>(w);
+                    if (nd >= dist_[v]) continue;
+                    if (inQueue_[v]) queueSum_ += static_cast<double>(nd - dist_[v]);
+                    dist_[v] = nd;
+                    pred_[v] = u;
+                    length_[v] = length_[u] + 1;
+                    if (length_[v] >= n || ++sinceCheck >= n) {
+                        sinceCheck = 0;
+                        if (findCycle(G)) return false;
+                    }
+                    if (!inQueue_[v]) enqueue(v);
+                }
+            }
+            return true;
+        }
+
+        // Returns false when a negative cycle is reachable from s. If round n
+        // is reached without the predecessor check finding the cycle (racing
+        // writers may leave predecessors stale), it falls back to run() so the
+        // reported cycle is exact.
+        template <typename W>
+        bool runParallel(const CsrGraph<W>& g, int s, ThreadPool& pool) {
+            const int n = g.size();
+            start(n, s);
+            seen_.assign(n, -1);
+            improved_.assign(pool.size(), {});
+
+            std::vector<int> frontier{s};
+            for (long long round = 0; !frontier.empty(); ++round) {
+                if (round >= n) {
+                    if (findCycle(g)) return false;
+                    long long iterations = iterations_, relaxations = relaxations_;
+                    bool ok = run(g, s);
+                    iterations_ += iterations;
+                    relaxations_ += relaxations;
+                    return ok;
+                }
+                ++iterations_;
+
+                std::atomic<long long> relaxed{0};
+                pool.forChunks(frontier.size(), [&](int worker, std::size_t b, std::size_t e) {
+                    auto& out = improved_[worker];
+                    long long count = 0;
+                    for (std::size_t i = b; i < e; ++i) {
+                        int u = frontier[i];
+                        Distance du = std::atomic_ref<Distance>(dist_[u]).load(std::memory_order_relaxed);
+                        for (auto [v, w] : g[u]) {
+                            ++count;
+                            Distance nd = du + static_cast<Distance>(w);
+                            std::atomic_ref<Distance> dv(dist_[v]);
+                            Distance cur = dv.load(std::memory_order_relaxed);
+                            while (nd < cur) {
+                                if (dv.compare_exchange_weak(cur, nd, std::memory_order_relaxed)) {
+                                    std::atomic_ref<int>(pred_[v]).store(u, std::memory_order_relaxed);
+                                    if (std::atomic_ref<long long>(seen_[v]).exchange(round, std::memory_order_relaxed) != round) {
+                                        out.push_back(v);
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    relaxed.fetch_add(count, std::memory_order_relaxed);
+                });
+                relaxations_ += relaxed.load();
+
+                frontier.clear();
+                for (auto& out : improved_) {
+                    frontier.insert(frontier.end(), out.begin(), out.end());
+                    out.clear();
+                }
+                if ((round + 1) % kParallelCheckRounds == 0 && findCycle(g)) return false;
+            }
+            return true;
+        }
+
+        Distance distance(int v) const { return dist_[v]; }
+        bool reached(int v) const { return dist_[v] != kInfinity; }
+
+        // Previous vertex on the current shortest path; -1 for the source and unreached vertices.
+        int predecessor(int v) const { return pred_[v]; }
+
+        const std::vector<Distance>& distances() const { return dist_; }
+
+        bool hasNegativeCycle() const { return !cycle_.empty(); }
+
+        // Vertices of the detected cycle; arc cycle[i] -> cycle[i + 1] and back to cycle[0].
+        const std::vector<int>& negativeCycle() const { return cycle_; }
+
+        // Vertices dequeued (run) or rounds (runParallel) in the last call.
+        long long iterations() const { return iterations_; }
+
+        // Arcs scanned in the last call.
+        long long relaxations() const { return relaxations_; }
+
+    private:
+        static constexpr long long kParallelCheckRounds = 8;
+
+        Order order_;
+        std::vector<Distance> dist_;
+        std::vector<int> pred_;
+        std::vector<int> cycle_;
+        long long iterations_ = 0;
+        long long relaxations_ = 0;
+
+        // run()
+        std::deque<int> queue_;
+        std::vector<char> inQueue_;
+        std::vector<int> length_;
+        double queueSum_ = 0;
+
+        // runParallel()
+        std::vector<long long> seen_; // last round v was put on the frontier
+        std::vector<std::vector<int>> improved_;
+
+        std::vector<int> walk_;
+
+        void start(int n, int s) {
+            if (s < 0 || s >= n) throw std::out_of_range("Spfa: source out of range");
+            dist_.assign(n, kInfinity);
+            pred_.assign(n, -1);
+            cycle_.clear();
+            iterations_ = 0;
+            relaxations_ = 0;
+            dist_[s] = 0;
+        }
+
+        void enqueue(int v) {
+            inQueue_[v] = 1;
+            queueSum_ += static_cast<double>(dist_[v]);
+            if (order_ != Order::Fifo && !queue_.empty() && dist_[v] < dist_[queue_.front()]) {
+                queue_.push_front(v);
+            } else {
+                queue_.push_back(v);
+            }
+        }
+
+        int dequeue() {
+            if (order_ == Order::SlfLll) {
+                for (std::size_t i = queue_.size(); i > 1; --i) {
+                    if (static_cast<double>(dist_[queue_.front()]) * static_cast<double>(queue_.size()) <= queueSum_) break;
+                    queue_.push_back(queue_.front());
+                    queue_.pop_front();
+                }
+            }
+            int u = queue_.front();
+            queue_.pop_front();
+            inQueue_[u] = 0;
+            queueSum_ -= static_cast<double>(dist_[u]);
+            return u;
+        }
+
+        // Look for a cycle in the predecessor graph in O(n). It is kept only
+        // if its weight in G is negative, which guards against predecessors
+        // written by racing threads.
+        template <typename Graph>
+        bool findCycle(const Graph& G) {
+            const int n = static_cast<int>(pred_.size());
+            walk_.assign(n, -1);
+            for (int v = 0; v < n; ++v) {
+                int x = v;
+                while (x != -1 && walk_[x] == -1) {
+                    walk_[x] = v;
+                    x = pred_[x];
+                }
+                if (x == -1 || walk_[x] != v) continue;
+
+                cycle_.clear();
+                int y = x;
+                do {
+                    cycle_.push_back(y);
+                    y = pred_[y];
+                } while (y != x);
+                std::reverse(cycle_.begin(), cycle_.end());
+                if (cycleWeight(G) < 0) return true;
+                cycle_.clear();
+            }
+            return false;
+        }
+
+        // Weight of cycle_ using the cheapest arc between consecutive vertices.
+        template <typename Graph>
+        Distance cycleWeight(const Graph& G) const {
+            Distance total = 0;
+            for (std::size_t i = 0; i < cycle_.size(); ++i) {
+                int u = cycle_[i], v = cycle_[(i + 1) % cycle_.size()];
+                Distance best = kInfinity;
+                for (auto [x, w] : G[u]) {
+                    if (x == v) best = std::min(best, static_cast<Distance>(w));
+                }
+                if (best == kInfinity) return 0;
+                total += best;
+            }
+            return total;
+        }
+    };
+
+} // namespace algo
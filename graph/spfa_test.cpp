@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "graph/csr_graph.hpp"
+#include "graph/dijkstra.hpp"
+#include "graph/spfa.hpp"
+#include "misc/thread_pool.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    using Edge = algo::CsrGraph<int>::Edge;
+
+    // Plain Bellman-Ford, n - 1 rounds over the edge list.
+    vector<long long> bellmanFord(int n, const vector<Edge>& edges, int s) {
+        const long long inf = algo::Spfa::kInfinity;
+        vector<long long> dist(n, inf);
+        dist[s] = 0;
+        for (int round = 1; round < n; round++) {
+            for (const Edge& e : edges) {
+                if (dist[e.from] != inf) dist[e.to] = min(dist[e.to], dist[e.from] + e.weight);
+            }
+        }
+        return dist;
+    }
+
+    // Random DAG-ish graph with negative weights but no negative cycle:
+    // potentials p make w(u, v) + p(u) - p(v) >= 0.
+    vector<Edge> potentialGraph(int n, int m, unsigned seed) {
+        mt19937 rng(seed);
+        vector<int> p(n);
+        for (int& x : p) x = rng() % 1000;
+        vector<Edge> edges;
+        for (int i = 0; i < m; i++) {
+            int u = rng() % n, v = rng() % n;
+            edges.push_back({u, v, (int) (rng() % 50) - p[u] + p[v]});
+        }
+        return edges;
+    }
+
+    // Grid with tiny weights along rows and large ones between rows, a
+    // classic input that makes FIFO SPFA re-scan vertices many times.
+    vector<Edge> adversarialGrid(int rows, int cols, unsigned seed) {
+        mt19937 rng(seed);
+        vector<Edge> edges;
+        auto id = [&](int r, int c) { return r * cols + c; };
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                if (c + 1 < cols) edges.push_back({id(r, c), id(r, c + 1), (int) (rng() % 10 + 1)});
+                if (r + 1 < rows) edges.push_back({id(r, c), id(r + 1, c), (int) (rng() % 100000 + 1)});
+            }
+        }
+        shuffle(edges.begin(), edges.end(), rng);
+        return edges;
+    }
+
+    void expectNegativeCycle(const algo::Spfa& spfa, const algo::CsrGraph<int>& g) {
+        ASSERT_TRUE(spfa.hasNegativeCycle());
+        const auto& cycle = spfa.negativeCycle();
+        long long total = 0;
+        for (size_t i = 0; i < cycle.size(); i++) {
+            int u = cycle[i], v = cycle[(i + 1) % cycle.size()];
+            long long best = algo::Spfa::kInfinity;
+            for (auto [x, w] : g[u]) {
+                if (x == v) best = min(best, (long long) w);
+            }
+            ASSERT_NE(best, algo::Spfa::kInfinity) << "no arc " << u << " -> " << v;
+            total += best;
+        }
+        EXPECT_LT(total, 0);
+    }
+
+    const algo::Spfa::Order kOrders[] = {algo::Spfa::Order::Fifo, algo::Spfa::Order::Slf, algo::Spfa::Order::SlfLll};
+}
+
+TEST(SpfaTest, NegativeWeightsMatchBellmanFord) {
+    algo::ThreadPool pool(4);
+    for (unsigned seed = 1; seed <= 5; seed++) {
+        auto edges = potentialGraph(300, 1500, seed);
+        algo::CsrGraph<int> g(300, edges);
+        auto expected = bellmanFord(300, edges, 0);
+
+        for (auto order : kOrders) {
+            algo::Spfa spfa(order);
+            EXPECT_TRUE(spfa.run(g, 0));
+            EXPECT_FALSE(spfa.hasNegativeCycle());
+            EXPECT_EQ(spfa.distances(), expected);
+            EXPECT_GT(spfa.iterations(), 0);
+            EXPECT_GE(spfa.relaxations(), spfa.iterations() - 1);
+            for (int v = 1; v < g.size(); v++) {
+                if (!spfa.reached(v)) continue;
+                int u = spfa.predecessor(v);
+                ASSERT_NE(u, -1);
+                bool tight = false;
+                for (auto [x, w] : g[u]) tight |= x == v && spfa.distance(u) + w == spfa.distance(v);
+                EXPECT_TRUE(tight) << u << " -> " << v;
+            }
+        }
+
+        algo::Spfa parallel;
+        EXPECT_TRUE(parallel.runParallel(g, 0, pool));
+        EXPECT_EQ(parallel.distances(), expected);
+    }
+}
+
+TEST(SpfaTest, AdversarialGridMatchesDijkstra) {
+    auto edges = adversarialGrid(40, 40, 9);
+    algo::CsrGraph<int> g(1600, edges);
+    algo::Dijkstra dijkstra(g.size());
+    dijkstra.run(g, 0);
+    vector<long long> expected(dijkstra.distances().begin(), dijkstra.distances().begin() + g.size());
+
+    for (auto order : kOrders) {
+        algo::Spfa spfa(order);
+        EXPECT_TRUE(spfa.run(g, 0));
+        EXPECT_EQ(spfa.distances(), expected);
+    }
+    algo::ThreadPool pool(3);
+    algo::Spfa parallel;
+    EXPECT_TRUE(parallel.runParallel(g, 0, pool));
+    EXPECT_EQ(parallel.distances(), expected);
+    EXPECT_LT(parallel.iterations(), g.size());
+}
+
+TEST(SpfaTest, DetectsNegativeCycle) {
+    algo::ThreadPool pool(4);
+    for (unsigned seed = 1; seed <= 5; seed++) {
+        auto edges = potentialGraph(200, 800, seed);
+        // Close a negative cycle somewhere reachable: 0 -> a -> b -> 0.
+        int a = 50 + seed, b = 120 + seed;
+        edges.push_back({0, a, 1});
+        edges.push_back({a, b, 1});
+        edges.push_back({b, 0, -5});
+        algo::CsrGraph<int> g(200, edges);
+
+        for (auto order : kOrders) {
+            algo::Spfa spfa(order);
+            EXPECT_FALSE(spfa.run(g, 0));
+            expectNegativeCycle(spfa, g);
+        }
+        algo::Spfa parallel;
+        EXPECT_FALSE(parallel.runParallel(g, 0, pool));
+        expectNegativeCycle(parallel, g);
+    }
+}
+
+TEST(SpfaTest, IgnoresUnreachableNegativeCycle) {
+    vector<Edge> edges = {{0, 1, 4}, {1, 2, -2}, {3, 4, -1}, {4, 3, -1}, {4, 2, 1}};
+    algo::CsrGraph<int> g(5, edges);
+    algo::ThreadPool pool(2);
+    for (auto order : kOrders) {
+        algo::Spfa spfa(order);
+        EXPECT_TRUE(spfa.run(g, 0));
+        EXPECT_EQ(spfa.distance(2), 2);
+        EXPECT_FALSE(spfa.reached(3));
+    }
+    algo::Spfa parallel;
+    EXPECT_TRUE(parallel.runParallel(g, 0, pool));
+    EXPECT_EQ(parallel.distance(2), 2);
+
+    algo::Spfa spfa;
+    EXPECT_FALSE(spfa.run(g, 3));
+    EXPECT_EQ(spfa.negativeCycle().size(), 2u);
+    EXPECT_THROW(spfa.run(g, 5), std::out_of_range);
+}
+
+TEST(SpfaTest, AcceptsAdjacencyLists) {
+    vector<vector<pair<int, int>>> G = {{{1, 5}, {2, 2}}, {{3, -4}}, {{1, 1}}, {}};
+    algo::Spfa spfa(algo::Spfa::Order::SlfLll);
+    EXPECT_TRUE(spfa.run(G, 0));
+    EXPECT_EQ(spfa.distance(3), -1);
+    EXPECT_EQ(spfa.predecessor(1), 2);
+}
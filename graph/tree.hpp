@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph/csr_graph.hpp"
+
+namespace algo {
+
+    // Rooted tree in flat arrays, built without recursion.
+    //
+    // Input is an undirected edge list (n - 1 pairs, or LeetCode-style
+    // {{u, v}, ...}), or anything Lca accepts (vector adjacency or a
+    // CsrGraph). Edges are bucketed into CSR with a counting sort; one
+    // explicit-stack DFS then fills:
+    //
+    //   parent, depth, subtreeSize    per vertex
+    //   tin / tout                    preorder index of v and of the last
+    //                                 vertex of its subtree, so the subtree
+    //                                 of v is preorder()[tin(v) .. tout(v)]
+    //   preorder(), postorder()       vertex orders
+    //   children(v)                   children in adjacency order, CSR
+    //
+    // Bottom-up passes walk preorder() backwards (children before parents),
+    // top-down passes walk it forwards; both are sequential scans. The
+    // children CSR is grouped by the parent's preorder index and also keeps
+    // the children's preorder indices, so the DP drivers below index their
+    // working arrays by preorder position and touch vertex ids only when
+    // calling back and when writing the result.
+    //
+    // subtreeDp() and reroot() drive tree DP in O(n) over a commutative
+    // monoid (identity, merge):
+    //   apply(value, child, parent) lifts a child's subtree value over the
+    //                               edge to its parent,
+    //   finalize(merged, v)         turns the merged contributions of v's
+    //                               neighbours into the value rooted at v.
+    // subtreeDp() gives the value of every subtree for the fixed root;
+    // reroot() gives, for every v, the value of the whole tree rooted at v,
+    // using prefix/suffix merges instead of an inverse.
+    class RootedTree {
+    public:
+        RootedTree(int n, std::span<const std::pair<int, int>> edges, int root = 0) : n_(n) {
+            if (n <= 0) throw std::invalid_argument("RootedTree: empty tree");
+            if (static_cast<long long>(edges.size()) != n - 1) {
+                throw std::invalid_argument("RootedTree: a tree on n vertices has n - 1 edges");
+            }
+            std::vector<int> offsets(n + 1, 0), adj(2 * edges.size());
+            for (auto [u, v] : edges) {
+                if (u < 0 || u >= n || v < 0 || v >= n) {
+                    throw std::out_of_range("RootedTree: edge (" + std::to_string(u) + ", " + std::to_string(v) +
+                                            ") out of range");
+                }
+                offsets[u + 1]++;
+                offsets[v + 1]++;
+            }
+            for (int u = 0; u < n; u++) offsets[u + 1] += offsets[u];
+            std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+            for (auto [u, v] : edges) {
+                adj[cursor[u]++] = v;
+                adj[cursor[v]++] = u;
+            }
+            build(Adjacency{offsets, adj}, root);
+        }
+
+        // LeetCode-style edge list: {{u, v}, ...}.
+        static RootedTree fromEdgeList(int n, const std::vector<std::vector<int>>& edges, int root = 0) {
+            std::vector<std::pair<int, int>> pairs;
+            pairs.reserve(edges.size());
+            for (const auto& e : edges) {
+                if (e.size() < 2) throw std::invalid_argument("RootedTree: edge needs two endpoints");
+                pairs.emplace_back(e[0], e[1]);
+            }
+            return RootedTree(n, pairs, root);
+        }
+
+        // Vector adjacency or CsrGraph, as for Lca.
+        template <typename Tree>
+        static RootedTree fromGraph(const Tree& tree, int root) {
+            RootedTree t;
+            t.n_ = static_cast<int>(tree.size());
+            if (t.n_ <= 0) throw std::invalid_argument("RootedTree: empty tree");
+            t.build(tree, root);
+            return t;
+        }
+
+        int size() const { return n_; }
+        int root() const { return preorder_[0]; }
+        int parent(int v) const { return parent_[v]; }
+        int depth(int v) const { return depth_[v]; }
+        int subtreeSize(int v) const { return size_[v]; }
+        int tin(int v) const { return tin_[v]; }
+        int tout(int v) const { return tin_[v] + size_[v] - 1; }
+
+        bool isAncestor(int u, int v) const { return tin_[u] <= tin_[v] && tin_[v] <= tout(u); }
+
+        std::span<const int> preorder() const { return preorder_; }
+        std::span<const int> postorder() const { return postorder_; }
+
+        std::span<const int> children(int v) const {
+            int i = tin_[v];
+            return {children_.data() + childOffsets_[i], static_cast<std::size_t>(childOffsets_[i + 1] - childOffsets_[i])};
+        }
+
+        template <typename T, typename Merge, typename Apply, typename Finalize>
+        std::vector<T> subtreeDp(const T& identity, Merge merge, Apply apply, Finalize finalize) const {
+            return byVertex(subtreeByPosition(identity, merge, apply, finalize), identity);
+        }
+
+        template <typename T, typename Merge, typename Apply, typename Finalize>
+        std::vector<T> reroot(const T& identity, Merge merge, Apply apply, Finalize finalize) const {
+            std::vector<T> sub = subtreeByPosition(identity, merge, apply, finalize);
+            // up[i]: contribution of everything outside the subtree at
+            // preorder position i, lifted to its root.
+            std::vector<T> up(n_, identity), result(n_, identity);
+            std::vector<T> lifted, suffix;
+            for (int i = 0; i < n_; i++) {
+                const int v = preorder_[i], first = childOffsets_[i];
+                const std::size_t k = static_cast<std::size_t>(childOffsets_[i + 1] - first);
+                lifted.resize(k);
+                suffix.assign(k + 1, identity);
+                for (std::size_t j = 0; j < k; j++) lifted[j] = apply(sub[childTin_[first + j]], children_[first + j], v);
+                for (std::size_t j = k; j-- > 0;) suffix[j] = merge(lifted[j], suffix[j + 1]);
+
+                T prefix = up[i];
+                result[i] = finalize(merge(prefix, suffix[0]), v);
+                for (std::size_t j = 0; j < k; j++) {
+                    up[childTin_[first + j]] = apply(finalize(merge(prefix, suffix[j + 1]), v), v, children_[first + j]);
+                    prefix = merge(prefix, lifted[j]);
+                }
+            }
+            return byVertex(std::move(result), identity);
+        }
+
+    private:
+        // Undirected CSR used while building from an edge list.
+        struct Adjacency {
+            const std::vector<int>& offsets;
+            const std::vector<int>& targets;
+
+            int size() const { return static_cast<int>(offsets.size()) - 1; }
+
+            friend std::span<const int> neighbors(const Adjacency& a, int u) {
+                return {a.targets.data() + a.offsets[u], static_cast<std::size_t>(a.offsets[u + 1] - a.offsets[u])};
+            }
+        };
+
+        RootedTree() = default;
+
+        // Subtree values indexed by preorder position.
+        template <typename T, typename Merge, typename Apply, typename Finalize>
+        std::vector<T> subtreeByPosition(const T& identity, Merge merge, Apply apply, Finalize finalize) const {
+            std::vector<T> sub(n_, identity);
+            for (int i = n_ - 1; i >= 0; i--) {
+                const int v = preorder_[i];
+                T acc = identity;
+                for (int j = childOffsets_[i]; j < childOffsets_[i + 1]; j++) {
+                    acc = merge(acc, apply(sub[childTin_[j]], children_[j], v));
+                }
+                sub[i] = finalize(acc, v);
+            }
+            return sub;
+        }
+
+        template <typename T>
+        std::vector<T> byVertex(std::vector<T> byPosition, const T& identity) const {
+            std::vector<T> result(n_, identity);
+            for (int i = 0; i < n_; i++) result[preorder_[i]] = std::move(byPosition[i]);
+            return result;
+        }
+
+        template <typename Tree>
+        void build(const Tree& tree, int root) {
+            if (root < 0 || root >= n_) throw std::out_of_range("RootedTree: root out of range");
+            parent_.assign(n_, -1);
+            depth_.assign(n_, 0);
+            size_.assign(n_, 1);
+            tin_.assign(n_, -1);
+            preorder_.clear();
+            preorder_.reserve(n_);
+            childOffsets_.assign(n_ + 1, 0);
+            children_.clear();
+            childTin_.clear();
+
+            // Children are pushed in reverse so they are visited in adjacency order.
+            std::vector<int> stack = {root};
+            tin_[root] = -2;
+            while (!stack.empty()) {
+                int u = stack.back();
+                stack.pop_back();
+                tin_[u] = static_cast<int>(preorder_.size());
+                preorder_.push_back(u);
+                std::size_t first = stack.size();
+                for (int v : neighbors(tree, u)) {
+                    if (v == parent_[u] || v == u) continue;
+                    if (tin_[v] != -1) throw std::invalid_argument("RootedTree: input has a cycle");
+                    tin_[v] = -2;
+                    parent_[v] = u;
+                    depth_[v] = depth_[u] + 1;
+                    stack.push_back(v);
+                }
+                std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(first), stack.end());
+            }
+            if (static_cast<int>(preorder_.size()) != n_) {
+                throw std::invalid_argument("RootedTree: tree is not connected");
+            }
+
+            // Children CSR by the parent's preorder index; children are
+            // appended in preorder, which is adjacency order.
+            for (int i = n_ - 1; i > 0; i--) {
+                int v = preorder_[i];
+                size_[parent_[v]] += size_[v];
+                childOffsets_[tin_[parent_[v]] + 1]++;
+            }
+            for (int i = 0; i < n_; i++) childOffsets_[i + 1] += childOffsets_[i];
+            children_.resize(n_ - 1);
+            childTin_.resize(n_ - 1);
+            std::vector<int> cursor(childOffsets_.begin(), childOffsets_.end() - 1);
+            for (int i = 1; i < n_; i++) {
+                int v = preorder_[i], slot = cursor[tin_[parent_[v]]]++;
+                children_[slot] = v;
+                childTin_[slot] = i;
+            }
+
+            // post(v) = tin(v) - depth(v) + size(v) - 1.
+            postorder_.assign(n_, 0);
+            for (int v = 0; v < n_; v++) postorder_[tin_[v] - depth_[v] + size_[v] - 1] = v;
+        }
+
+        int n_ = 0;
+        std::vector<int> parent_, depth_, size_, tin_;
+        std::vector<int> preorder_, postorder_;
+        // childOffsets_ is indexed by preorder position; children_ holds
+        // vertex ids and childTin_ their preorder positions.
+        std::vector<int> childOffsets_, children_, childTin_;
+    };
+
+} // namespace algo
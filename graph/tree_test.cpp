@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "graph/tree.hpp"
+
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    vector<pair<int, int>> randomEdges(int n, unsigned seed) {
+        mt19937 rng(seed);
+        vector<int> perm(n);
+        for (int i = 0; i < n; i++) perm[i] = i;
+        shuffle(perm.begin(), perm.end(), rng);
+        vector<pair<int, int>> edges;
+        for (int i = 1; i < n; i++) {
+            int p = seed % 2 ? (int) (rng() % i) : i - 1;
+            if (rng() % 2) edges.push_back({perm[i], perm[p]});
+            else edges.push_back({perm[p], perm[i]});
+        }
+        return edges;
+    }
+
+    vector<int> bfsDistances(const vector<vector<int>>& adj, int s) {
+        vector<int> dist(adj.size(), -1);
+        queue<int> q;
+        q.push(s);
+        dist[s] = 0;
+        while (!q.empty()) {
+            int u = q.front();
+            q.pop();
+            for (int v : adj[u]) {
+                if (dist[v] == -1) {
+                    dist[v] = dist[u] + 1;
+                    q.push(v);
+                }
+            }
+        }
+        return dist;
+    }
+}
+
+TEST(RootedTreeTest, SmallTree) {
+    // 0 -> {1, 2}, 1 -> {3, 4}, 2 -> {5}
+    vector<vector<int>> edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {2, 5}};
+    auto tree = algo::RootedTree::fromEdgeList(6, edges);
+    EXPECT_EQ(tree.root(), 0);
+    EXPECT_EQ(vector<int>(tree.preorder().begin(), tree.preorder().end()), (vector<int>{0, 1, 3, 4, 2, 5}));
+    EXPECT_EQ(vector<int>(tree.postorder().begin(), tree.postorder().end()), (vector<int>{3, 4, 1, 5, 2, 0}));
+    EXPECT_EQ(tree.parent(4), 1);
+    EXPECT_EQ(tree.parent(0), -1);
+    EXPECT_EQ(tree.depth(5), 2);
+    EXPECT_EQ(tree.subtreeSize(1), 3);
+    EXPECT_EQ(tree.tin(2), 4);
+    EXPECT_EQ(tree.tout(1), 3);
+    EXPECT_TRUE(tree.isAncestor(1, 4));
+    EXPECT_FALSE(tree.isAncestor(2, 4));
+    EXPECT_EQ(vector<int>(tree.children(1).begin(), tree.children(1).end()), (vector<int>{3, 4}));
+    EXPECT_TRUE(tree.children(5).empty());
+}
+
+TEST(RootedTreeTest, TraversalInvariants) {
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        int n = 1 + seed * 97;
+        auto edges = randomEdges(n, seed);
+        int root = seed % n;
+        algo::RootedTree tree(n, edges, root);
+        vector<int> post(n);
+        for (int i = 0; i < n; i++) post[tree.postorder()[i]] = i;
+        for (int v = 0; v < n; v++) {
+            EXPECT_EQ(tree.preorder()[tree.tin(v)], v);
+            int size = 1;
+            for (int c : tree.children(v)) {
+                EXPECT_EQ(tree.parent(c), v);
+                EXPECT_EQ(tree.depth(c), tree.depth(v) + 1);
+                EXPECT_LT(post[c], post[v]);
+                size += tree.subtreeSize(c);
+            }
+            EXPECT_EQ(tree.subtreeSize(v), size);
+            // The vertex after v's subtree in preorder is not a descendant.
+            if (tree.tout(v) + 1 < n) {
+                int w = tree.preorder()[tree.tout(v) + 1];
+                EXPECT_LE(tree.depth(w), tree.depth(v));
+            }
+        }
+    }
+}
+
+TEST(RootedTreeTest, RerootingMatchesBruteForce) {
+    for (unsigned seed = 1; seed <= 8; seed++) {
+        int n = 2 + seed * 40;
+        auto edges = randomEdges(n, seed);
+        vector<vector<int>> adj(n);
+        for (auto [u, v] : edges) {
+            adj[u].push_back(v);
+            adj[v].push_back(u);
+        }
+        auto tree = algo::RootedTree::fromGraph(adj, 0);
+
+        // Sum of distances to all vertices: (count, sum).
+        using P = pair<long long, long long>;
+        auto sums = tree.reroot(
+            P{0, 0}, [](P a, P b) { return P{a.first + b.first, a.second + b.second}; },
+            [](P x, int, int) { return P{x.first, x.second + x.first}; },
+            [](P x, int) { return P{x.first + 1, x.second}; });
+        // Eccentricity: height of the tree rooted at v.
+        auto ecc = tree.reroot(
+            -1, [](int a, int b) { return max(a, b); }, [](int x, int, int) { return x + 1; },
+            [](int x, int) { return max(x, 0); });
+        auto sizes = tree.subtreeDp(
+            0, [](int a, int b) { return a + b; }, [](int x, int, int) { return x; },
+            [](int x, int) { return x + 1; });
+
+        for (int v = 0; v < n; v++) {
+            auto dist = bfsDistances(adj, v);
+            long long total = 0;
+            for (int d : dist) total += d;
+            EXPECT_EQ(sums[v].first, n);
+            EXPECT_EQ(sums[v].second, total);
+            EXPECT_EQ(ecc[v], *max_element(dist.begin(), dist.end()));
+            EXPECT_EQ(sizes[v], tree.subtreeSize(v));
+        }
+    }
+}
+
+TEST(RootedTreeTest, MillionVertexPath) {
+    const int n = 1000000;
+    vector<pair<int, int>> edges;
+    for (int i = 1; i < n; i++) edges.push_back({i - 1, i});
+    algo::RootedTree tree(n, edges);
+    EXPECT_EQ(tree.depth(n - 1), n - 1);
+    EXPECT_EQ(tree.subtreeSize(0), n);
+    EXPECT_EQ(tree.postorder()[0], n - 1);
+    auto ecc = tree.reroot(
+        -1, [](int a, int b) { return max(a, b); }, [](int x, int, int) { return x + 1; },
+        [](int x, int) { return max(x, 0); });
+    EXPECT_EQ(ecc[0], n - 1);
+    EXPECT_EQ(ecc[n / 2], n / 2);
+}
+
+TEST(RootedTreeTest, CsrInputAndInvalidTrees) {
+    vector<algo::CsrGraph<int>::Edge> arcs = {{0, 1, 1}, {1, 2, 1}, {1, 3, 1}};
+    algo::CsrGraph<int> g(4, arcs, {.undirected = true});
+    auto tree = algo::RootedTree::fromGraph(g, 1);
+    EXPECT_EQ(tree.root(), 1);
+    EXPECT_EQ(tree.subtreeSize(1), 4);
+    EXPECT_EQ(tree.parent(0), 1);
+
+    vector<pair<int, int>> cycle = {{0, 1}, {1, 2}, {2, 0}};
+    EXPECT_THROW(algo::RootedTree(3, cycle), std::invalid_argument);
+    vector<pair<int, int>> split = {{0, 1}, {0, 1}};
+    EXPECT_THROW(algo::RootedTree(3, split), std::invalid_argument);
+    vector<pair<int, int>> bad = {{0, 3}};
+    EXPECT_THROW(algo::RootedTree(2, bad), std::out_of_range);
+    EXPECT_THROW(algo::RootedTree(2, vector<pair<int, int>>{{0, 1}}, 2), std::out_of_range);
+    EXPECT_THROW(algo::RootedTree::fromEdgeList(2, {{0}}), std::invalid_argument);
+    vector<vector<int>> loop = {{1, 2}, {0, 2}, {0, 1}};
+    EXPECT_THROW(algo::RootedTree::fromGraph(loop, 0), std::invalid_argument);
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace algo {
+
+    // View of a whole file.
+    //
+    // On POSIX systems the file is mmap'ed, so pages are faulted in lazily and
+    // shared with the page cache. Elsewhere the file is read into memory once.
+    // Throws std::runtime_error when the file cannot be opened or mapped.
+    //
+    // Access is passed to madvise(): Sequential for a front-to-back scan (the
+    // kernel reads ahead aggressively and drops pages behind the scan),
+    // Random for point lookups (no read-ahead), Normal otherwise.
+    //
+    // create() makes a new file of a given size and maps it writable, so the
+    // file can be filled in place; sync() flushes it and reports errors.
+    class MappedFile {
+    public:
+        enum class Access { Normal, Sequential, Random };
+
+        MappedFile() = default;
+
+        explicit MappedFile(const std::string& path, Access access = Access::Normal) {
+#if defined(_WIN32)
+            (void) access;
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in) throw std::runtime_error("MappedFile: cannot open " + path);
+            buffer_.resize(static_cast<std::size_t>(in.tellg()));
+            in.seekg(0);
+            in.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("MappedFile: cannot open " + path);
+            struct stat st {};
+            if (::fstat(fd, &st) != 0) {
+                ::close(fd);
+                throw std::runtime_error("MappedFile: cannot stat " + path);
+            }
+            size_ = static_cast<std::size_t>(st.st_size);
+            if (size_ > 0) {
+                void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("MappedFile: cannot map " + path);
+                }
+                ::madvise(p, size_, advice(access));
+                data_ = static_cast<const char*>(p);
+            }
+            ::close(fd);
+#endif
+        }
+
+        // Creates (or truncates) `path` with `size` zero bytes, mapped writable.
+        static MappedFile create(const std::string& path, std::size_t size) {
+            MappedFile f;
+            f.writable_ = true;
+            f.size_ = size;
+#if defined(_WIN32)
+            f.path_ = path;
+            f.buffer_.assign(size, 0);
+            f.data_ = f.buffer_.data();
+#else
+            int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) throw std::runtime_error("MappedFile: cannot create " + path);
+            // Reserve the blocks now: running out of space later would be a
+            // SIGBUS on the first write to the page.
+            if (size > 0 && ::posix_fallocate(fd, 0, static_cast<off_t>(size)) != 0) {
+                ::close(fd);
+                throw std::runtime_error("MappedFile: cannot allocate " + path);
+            }
+            if (size > 0) {
+                void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (p == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("MappedFile: cannot map " + path);
+                }
+                f.data_ = static_cast<const char*>(p);
+            }
+            ::close(fd);
+#endif
+            return f;
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept {
+            swap(other);
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                MappedFile tmp(std::move(other));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~MappedFile() {
+#if !defined(_WIN32)
+            if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        const char* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        // Only for files opened with create().
+        char* writableData() {
+            if (!writable_) throw std::logic_error("MappedFile: file is mapped read-only");
+            return const_cast<char*>(data_);
+        }
+
+        // Writes a created file back to disk.
+        void sync() {
+            if (!writable_) return;
+#if defined(_WIN32)
+            std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+            out.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            if (!out) throw std::runtime_error("MappedFile: cannot write " + path_);
+#else
+            if (data_ != nullptr && ::msync(const_cast<char*>(data_), size_, MS_SYNC) != 0) {
+                throw std::runtime_error("MappedFile: cannot write back mapping");
+            }
+#endif
+        }
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool writable_ = false;
+#if defined(_WIN32)
+        std::vector<char> buffer_;
+        std::string path_;
+#else
+        static int advice(Access access) {
+            switch (access) {
+            case Access::Sequential: return MADV_SEQUENTIAL;
+            case Access::Random: return MADV_RANDOM;
+            default: return MADV_NORMAL;
+            }
+        }
+#endif
+
+        void swap(MappedFile& other) noexcept {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(writable_, other.writable_);
+#if defined(_WIN32)
+            std::swap(buffer_, other.buffer_);
+            std::swap(path_, other.path_);
+#endif
+        }
+    };
+
+} // namespace algo
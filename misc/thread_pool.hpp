@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace algo {
+
+    // Fixed-size pool of persistent worker threads for data-parallel loops.
+    //
+    // The calling thread takes part as worker 0, so ThreadPool(1) runs
+    // everything inline without spawning threads. Worker ids passed to the
+    // callbacks are in [0, size()) and can index per-thread scratch space.
+    //
+    //   forChunks(n, fn) : fn(worker, begin, end), one contiguous chunk each.
+    //   forEach(n, fn)   : fn(worker, i) for every i, handed out dynamically
+    //                      in small grains, for uneven work items.
+    //
+    // Both block until every worker is done and rethrow the first exception
+    // thrown by a callback. Calls from several threads are serialized.
+    //
+    // A forChunks / forEach issued from inside a job of the same pool runs
+    // inline on the calling worker (with its worker id) instead of waiting
+    // for workers that are busy with the outer job. A nested run() cannot be
+    // served that way and throws std::logic_error.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(int threads = static_cast<int>(std::thread::hardware_concurrency())) {
+            threads = std::max(1, threads);
+            for (int i = 1; i < threads; ++i) {
+                workers_.emplace_back([this, i] { workerLoop(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& t : workers_) t.join();
+        }
+
+        int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+        // Worker id of the calling thread while it runs a job of this pool, else -1.
+        int currentWorker() const {
+            return active_ == this ? activeWorker_ : -1;
+        }
+
+        template <typename F>
+        void forChunks(std::size_t n, F&& fn) {
+            if (int worker = currentWorker(); worker >= 0) {
+                if (n > 0) fn(worker, std::size_t{0}, n);
+                return;
+            }
+            const std::size_t parts = static_cast<std::size_t>(size());
+            run([&](int worker) {
+                std::size_t begin = n * worker / parts;
+                std::size_t end = n * (worker + 1) / parts;
+                if (begin < end) fn(worker, begin, end);
+            });
+        }
+
+        template <typename F>
+        void forEach(std::size_t n, F&& fn, std::size_t grain = 1) {
+            if (int worker = currentWorker(); worker >= 0) {
+                for (std::size_t i = 0; i < n; ++i) fn(worker, i);
+                return;
+            }
+            grain = std::max<std::size_t>(1, grain);
+            std::atomic<std::size_t> next{0};
+            run([&](int worker) {
+                for (;;) {
+                    std::size_t begin = next.fetch_add(grain, std::memory_order_relaxed);
+                    if (begin >= n) break;
+                    std::size_t end = std::min(n, begin + grain);
+                    for (std::size_t i = begin; i < end; ++i) fn(worker, i);
+                }
+            });
+        }
+
+        // Run job(worker) once on every worker.
+        void run(const std::function<void(int)>& job) {
+            if (currentWorker() >= 0) throw std::logic_error("ThreadPool::run: nested call from a job of the same pool");
+            std::lock_guard serial(runMutex_);
+            if (workers_.empty()) {
+                ActiveScope scope(this, 0);
+                job(0);
+                return;
+            }
+            {
+                std::lock_guard lock(mutex_);
+                job_ = &job;
+                error_ = nullptr;
+                pending_ = static_cast<int>(workers_.size());
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            std::exception_ptr local;
+            try {
+                ActiveScope scope(this, 0);
+                job(0);
+            } catch (...) {
+                local = std::current_exception();
+            }
+
+            std::unique_lock lock(mutex_);
+            done_.wait(lock, [this] { return pending_ == 0; });
+            job_ = nullptr;
+            if (!local) local = error_;
+            lock.unlock();
+            if (local) std::rethrow_exception(local);
+        }
+
+    private:
+        std::vector<std::thread> workers_;
+        std::mutex runMutex_;
+        std::mutex mutex_;
+        std::condition_variable wake_, done_;
+        const std::function<void(int)>* job_ = nullptr;
+        std::exception_ptr error_;
+        unsigned long long generation_ = 0;
+        int pending_ = 0;
+        bool stop_ = false;
+
+        // The pool and worker id whose job the current thread is running.
+        static inline thread_local const ThreadPool* active_ = nullptr;
+        static inline thread_local int activeWorker_ = -1;
+
+        struct ActiveScope {
+            const ThreadPool* savedPool;
+            int savedWorker;
+
+            ActiveScope(const ThreadPool* pool, int worker) : savedPool(active_), savedWorker(activeWorker_) {
+                active_ = pool;
+                activeWorker_ = worker;
+            }
+
+            ~ActiveScope() {
+                active_ = savedPool;
+                activeWorker_ = savedWorker;
+            }
+        };
+
+        void workerLoop(int id) {
+            unsigned long long seen = 0;
+            for (;;) {
+                const std::function<void(int)>* job;
+                {
+                    std::unique_lock lock(mutex_);
+                    wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                    if (stop_) return;
+                    seen = generation_;
+                    job = job_;
+                }
+
+                std::exception_ptr err;
+                try {
+                    ActiveScope scope(this, id);
+                    (*job)(id);
+                } catch (...) {
+                    err = std::current_exception();
+                }
+
+                std::lock_guard lock(mutex_);
+                if (err && !error_) error_ = err;
+                if (--pending_ == 0) done_.notify_one();
+            }
+        }
+    };
+
+} // namespace algo
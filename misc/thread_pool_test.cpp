@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, ForChunksCoversRange) {
+    algo::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+
+    std::vector<int> hits(1000, 0);
+    pool.forChunks(hits.size(), [&](int, std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) hits[i]++;
+    });
+    for (int h : hits) EXPECT_EQ(h, 1);
+}
+
+TEST(ThreadPoolTest, ForEachUsesWorkerScratch) {
+    algo::ThreadPool pool(3);
+    std::vector<long long> partial(pool.size(), 0);
+    pool.forEach(10000, [&](int worker, std::size_t i) { partial[worker] += i; }, 64);
+
+    long long total = 0;
+    for (long long p : partial) total += p;
+    EXPECT_EQ(total, 10000LL * 9999 / 2);
+}
+
+TEST(ThreadPoolTest, InlineAndExceptions) {
+    algo::ThreadPool single(1);
+    int calls = 0;
+    single.forEach(5, [&](int worker, std::size_t) {
+        EXPECT_EQ(worker, 0);
+        calls++;
+    });
+    EXPECT_EQ(calls, 5);
+
+    algo::ThreadPool pool(4);
+    EXPECT_THROW(pool.forEach(100, [](int, std::size_t i) {
+        if (i == 42) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    // Still usable after a failed job.
+    std::atomic<int> count{0};
+    pool.forEach(100, [&](int, std::size_t) { count++; });
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPoolTest, NestedLoopsRunInline) {
+    algo::ThreadPool pool(4);
+    std::vector<long long> partial(pool.size(), 0);
+    pool.forEach(8, [&](int worker, std::size_t i) {
+        EXPECT_EQ(pool.currentWorker(), worker);
+        pool.forChunks(100, [&](int inner, std::size_t b, std::size_t e) {
+            EXPECT_EQ(inner, worker);
+            for (std::size_t j = b; j < e; ++j) partial[inner] += static_cast<long long>(i * 100 + j);
+        });
+    });
+    long long total = 0;
+    for (long long p : partial) total += p;
+    EXPECT_EQ(total, 800LL * 799 / 2);
+    EXPECT_EQ(pool.currentWorker(), -1);
+
+    EXPECT_THROW(pool.forEach(4, [&](int, std::size_t) { pool.run([](int) {}); }), std::logic_error);
+
+    // A different pool is not nested.
+    algo::ThreadPool other(2);
+    std::atomic<int> count{0};
+    pool.forEach(4, [&](int, std::size_t) {
+        other.forEach(10, [&](int, std::size_t) { count++; });
+    });
+    EXPECT_EQ(count.load(), 40);
+}